@@ -8,6 +8,9 @@
 #include <cutil/util/macro.h>
 
 #include <app/video.h>
+#include <data/pixel.h>
+#include <util/cpu.h>
+#include <visuals/palette.h>
 
 static const char *const DEFAULT_ENVIRONMENT_PATH = "../env/";
 
@@ -18,6 +21,23 @@ static struct {
     Video *video;
 } *_app = NULL;
 
+/**
+ * Selects the variants of the hot kernels for the instruction sets supported
+ * by the CPU.
+ */
+static void
+_app_select_isa(void)
+{
+    const enum CpuIsa isa = Cpu_detect_isa();
+    const enum CpuIsa pixel_isa = PixelData_select_isa(isa);
+    const enum CpuIsa palette_isa = Palette_select_isa(isa);
+    cutil_log_info(
+      "Detected %s CPU, using %s iteration and %s palette kernels",
+      Cpu_get_isa_name(isa), Cpu_get_isa_name(pixel_isa),
+      Cpu_get_isa_name(palette_isa)
+    );
+}
+
 static void
 _app_create(const char *env_path, const Settings *settings)
 {
@@ -28,6 +48,8 @@ _app_create(const char *env_path, const Settings *settings)
 
     _app = calloc(1, sizeof *_app);
 
+    _app_select_isa();
+
     _app->env_path = cutil_strdup(env_path);
     _app->settings = Settings_duplicate(settings);
     _app->gfxdata = GraphicsData_app_init();
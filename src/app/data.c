@@ -59,3 +59,9 @@ GraphicsData_get_pixel_data(const GraphicsData *gfxdata)
 {
     return ImageData_get_pixel_data(gfxdata->imgdata);
 }
+
+int
+GraphicsData_get_skipped_itrs(const GraphicsData *gfxdata)
+{
+    return ImageData_get_skipped_itrs(gfxdata->imgdata);
+}
@@ -61,4 +61,15 @@ GraphicsData_perform_action(GraphicsData *gfxdata, unsigned int mseconds);
 const float *
 GraphicsData_get_pixel_data(const GraphicsData *gfxdata);
 
+/**
+ * Returns the number of iterations skipped by the series approximation for
+ * every pixel in `gfxdata`.
+ *
+ * @param[in] gfxdata GraphicsData object to get number of skipped iterations of
+ *
+ * @return number of iterations skipped for every pixel in `gfxdata`
+ */
+int
+GraphicsData_get_skipped_itrs(const GraphicsData *gfxdata);
+
 #endif /* MANDELBROT_APP_DATA_H_INCLUDED */
@@ -21,6 +21,8 @@ Key_get_cooldown(enum Key key)
     case KEY_RESET:
     case KEY_VIEW_SAVE:
     case KEY_VIEW_LOAD:
+    case KEY_TOGGLE_BLA:
+    case KEY_SNAP_NUCLEUS:
         return 500U;
     case KEY_TRIP_MODE:
     case KEY_QUIT:
@@ -71,6 +73,10 @@ _default_keymap_map(SDL_Keycode sdl_key)
         return KEY_VIEW_SAVE;
     case SDLK_F9:
         return KEY_VIEW_LOAD;
+    case SDLK_b:
+        return KEY_TOGGLE_BLA;
+    case SDLK_m:
+        return KEY_SNAP_NUCLEUS;
     case SDLK_c:
         return KEY_CHANGE_PALETTE;
     case SDLK_t:
@@ -103,6 +109,8 @@ KeyCategory_categorize(enum Key key)
     case KEY_RESET:
     case KEY_VIEW_SAVE:
     case KEY_VIEW_LOAD:
+    case KEY_TOGGLE_BLA:
+    case KEY_SNAP_NUCLEUS:
         return KEYCATEGORY_DATA;
     case KEY_QUIT:
     case KEY_CHANGE_PALETTE:
@@ -22,6 +22,8 @@ enum Key {
     KEY_RESET,
     KEY_VIEW_SAVE,
     KEY_VIEW_LOAD,
+    KEY_TOGGLE_BLA,
+    KEY_SNAP_NUCLEUS,
     KEY_CHANGE_PALETTE,
     KEY_TRIP_MODE,
     KEY_COUNT,
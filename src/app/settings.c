@@ -24,6 +24,8 @@
 #define DEFAULT_TRIP_MODE 0
 
 #define DEFAULT_VIEW_FILENAME "view.json"
+#define DEFAULT_KERNEL "auto"
+#define DEFAULT_FILL "border"
 
 static const Settings DEFAULT_SETTINGS_OBJECT = {
   .width = DEFAULT_WIDTH,
@@ -39,6 +41,8 @@ static const Settings DEFAULT_SETTINGS_OBJECT = {
   .palette_idx = DEFAULT_PALETTE_INDEX,
   .trip_mode = DEFAULT_TRIP_MODE,
   .view_file = DEFAULT_VIEW_FILENAME,
+  .kernel = DEFAULT_KERNEL,
+  .fill = DEFAULT_FILL,
 };
 
 const Settings *const DEFAULT_SETTINGS = &DEFAULT_SETTINGS_OBJECT;
@@ -55,6 +59,8 @@ Settings_free(Settings *settings)
     CUTIL_RETURN_IF_NULL(settings);
 
     free(settings->view_file);
+    free(settings->kernel);
+    free(settings->fill);
 
     free(settings);
 }
@@ -66,6 +72,8 @@ Settings_duplicate(const Settings *settings)
 
     memcpy(dup, settings, sizeof *settings);
     dup->view_file = cutil_strdup(settings->view_file);
+    dup->kernel = cutil_strdup(settings->kernel);
+    dup->fill = cutil_strdup(settings->fill);
 
     return dup;
 }
@@ -115,6 +123,8 @@ Settings_fill_from_Json(Settings *settings, const Json *json)
     JSON_TO_MEMBER(int, trip_mode);
 
     JSON_TO_MEMBER(str, view_file);
+    JSON_TO_MEMBER(str, kernel);
+    JSON_TO_MEMBER(str, fill);
 
 #undef JSON_TO_MEMBER
 }
@@ -159,6 +169,8 @@ Settings_to_Json(const Settings *settings)
     MEMBER_TO_JSON(int, trip_mode);
 
     MEMBER_TO_JSON(str, view_file);
+    MEMBER_TO_JSON(str, kernel);
+    MEMBER_TO_JSON(str, fill);
 
 #undef MEMBER_TO_JSON
 
@@ -28,6 +28,8 @@ typedef struct {
     int palette_idx;   /* Default index of colour palette*/
     int trip_mode;     /* Type of trip mode */
     char *view_file;   /* File to save view to */
+    char *kernel;      /* Arithmetic kernel ("auto" for automatic choice) */
+    char *fill;        /* Filling of chunks ("off" to iterate every pixel) */
 } Settings;
 
 /**
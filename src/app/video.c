@@ -4,6 +4,7 @@
 
 #include <cutil/io/log.h>
 #include <cutil/std/stdbool.h>
+#include <cutil/std/stdio.h>
 #include <cutil/util/macro.h>
 
 #include <app/app.h>
@@ -25,6 +26,7 @@ struct Video {
     const void *palette_params;
     PaletteCycler *cycler;
     TripModeGenerator *tripgen;
+    int skipped_itrs;
 };
 
 static void
@@ -61,6 +63,7 @@ _video_alloc(const Settings *settings, GraphicsData *gfxdata)
     );
     video->palette = PaletteCycler_cycle_palette(video->cycler);
     video->tripgen = TripModeGenerator_create(settings->trip_mode);
+    video->skipped_itrs = 0;
 
     const int width = settings->width;
     const int height = settings->height;
@@ -101,17 +104,41 @@ _video_write_framebuffer(Video *video)
     const float *const pxdata = GraphicsData_get_pixel_data(gfxdata);
     uint32_t *const buf = video->image->pixels;
     int i;
-#pragma omp parallel for collapse(2)
+#pragma omp parallel for
     for (i = 0; i < width; ++i) {
-        for (int j = 0; j < height; ++j) {
-            buf[j * width + i]
-              = video->palette(pxdata[i * height + j], video->palette_params);
-        }
+        Palette_map(
+          video->palette, video->palette_params, &pxdata[i * height], height,
+          &buf[i], width
+        );
     }
 
     SDL_UnlockSurface(video->image);
 }
 
+/**
+ * Shows the number of iterations skipped by the series approximation in the
+ * window title of `video`.
+ */
+static void
+_video_update_title(Video *video)
+{
+    const int skipped_itrs = GraphicsData_get_skipped_itrs(video->gfxdata);
+    if (skipped_itrs == video->skipped_itrs) {
+        return;
+    }
+    video->skipped_itrs = skipped_itrs;
+
+    if (skipped_itrs == 0) {
+        SDL_SetWindowTitle(video->window, "mandelbrot");
+        return;
+    }
+    char title[64];
+    snprintf(
+      title, sizeof title, "mandelbrot (%i iterations skipped)", skipped_itrs
+    );
+    SDL_SetWindowTitle(video->window, title);
+}
+
 static void
 _video_cycle_palette(Video *video)
 {
@@ -207,6 +234,7 @@ _video_loop(Video *video)
     for (;;) {
         if (GraphicsData_perform_action(gfxdata, msecs_per_frame)) {
             _video_write_framebuffer(video);
+            _video_update_title(video);
         }
         _video_draw_image(video);
         SDL_UpdateWindowSurface(video->window);
@@ -0,0 +1,127 @@
+#include <data/bla.h>
+
+#include <cutil/std/math.h>
+#include <cutil/std/stdlib.h>
+
+/**
+ * Maximum relative size of the neglected non-linear term of a single step
+ */
+#define BLA_EPSILON 0x1p-53
+
+void
+BlaTable_init(BlaTable *bla)
+{
+    bla->num_levels = 0;
+    bla->num = NULL;
+    bla->data = NULL;
+    bla->cap = 0;
+}
+
+void
+BlaTable_clear(BlaTable *bla)
+{
+    for (int k = 0; k < bla->num_levels; ++k) {
+        free(bla->data[k]);
+    }
+    free(bla->data);
+    free(bla->num);
+}
+
+static void
+_blaTable_reserve(BlaTable *bla, int num_steps)
+{
+    if (num_steps <= bla->cap) {
+        return;
+    }
+    BlaTable_clear(bla);
+
+    int num_levels = 0;
+    while ((num_steps >> num_levels) > 0) {
+        ++num_levels;
+    }
+
+    bla->num_levels = num_levels;
+    bla->num = malloc(num_levels * sizeof *bla->num);
+    bla->data = malloc(num_levels * sizeof *bla->data);
+    for (int k = 0; k < num_levels; ++k) {
+        const int num = num_steps >> k;
+        bla->data[k] = malloc(num * sizeof *bla->data[k]);
+    }
+    bla->cap = num_steps;
+}
+
+/**
+ * Computes the BLA of the single step starting at the orbit point (`z_re`,
+ * `z_im`), i.e., d_{n+1} = 2 Z_n d_n + dc, which is valid as long as the
+ * neglected d_n^2 is small compared to 2 Z_n d_n.
+ */
+static void
+_blaEntry_init_step(BlaEntry *entry, double z_re, double z_im)
+{
+    entry->a_re = 2.0 * z_re;
+    entry->a_im = 2.0 * z_im;
+    entry->b_re = 1.0;
+    entry->b_im = 0.0;
+
+    const double r = BLA_EPSILON * hypot(z_re, z_im);
+    entry->r_sqr = r * r;
+}
+
+/**
+ * Merges the BLAs `x` and `y` of consecutive blocks (`x` first) into `entry`.
+ */
+static void
+_blaEntry_merge(
+  BlaEntry *entry, const BlaEntry *x, const BlaEntry *y, double dc_max
+)
+{
+    entry->a_re = y->a_re * x->a_re - y->a_im * x->a_im;
+    entry->a_im = y->a_re * x->a_im + y->a_im * x->a_re;
+    entry->b_re = y->a_re * x->b_re - y->a_im * x->b_im + y->b_re;
+    entry->b_im = y->a_re * x->b_im + y->a_im * x->b_re + y->b_im;
+
+    const double a_x_abs = hypot(x->a_re, x->a_im);
+    const double b_x_abs = hypot(x->b_re, x->b_im);
+    const double r_x = sqrt(x->r_sqr);
+    const double r_y = sqrt(y->r_sqr);
+    double r = (a_x_abs > 0.0) ? (r_y - b_x_abs * dc_max) / a_x_abs : 0.0;
+    if (r > r_x) {
+        r = r_x;
+    }
+    entry->r_sqr = (r > 0.0 && isfinite(r)) ? r * r : 0.0;
+}
+
+void
+BlaTable_compute(BlaTable *bla, const ReferenceOrbit *orbit, double dc_max)
+{
+    /* Last orbit point may have escaped, so no step may start there */
+    const int num_steps = orbit->len - 1;
+    _blaTable_reserve(bla, num_steps);
+
+    const int num_levels = bla->num_levels;
+    for (int k = 0; k < num_levels; ++k) {
+        bla->num[k] = num_steps >> k;
+    }
+
+    BlaEntry *const steps = bla->data[0];
+    for (int n = 0; n < bla->num[0]; ++n) {
+        const double z_re = orbit->orbit_re[n];
+        const double z_im = orbit->orbit_im[n];
+        _blaEntry_init_step(&steps[n], z_re, z_im);
+    }
+
+    for (int k = 1; k < num_levels; ++k) {
+        const BlaEntry *const lower = bla->data[k - 1];
+        BlaEntry *const upper = bla->data[k];
+        for (int j = 0; j < bla->num[k]; ++j) {
+            const BlaEntry *const x = &lower[2 * j];
+            const BlaEntry *const y = &lower[2 * j + 1];
+            _blaEntry_merge(&upper[j], x, y, dc_max);
+        }
+    }
+}
+
+extern inline const BlaEntry *
+BlaTable_lookup(
+  const BlaTable *bla, int itrs, double d_sqr, int max_steps, int *steps
+);
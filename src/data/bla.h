@@ -0,0 +1,107 @@
+/* data/bla.h
+ *
+ * Header for tables of bivariate linear approximations (for perturbation)
+ *
+ */
+
+#ifndef MANDELBROT_DATA_BLA_H_INCLUDED
+#define MANDELBROT_DATA_BLA_H_INCLUDED
+
+#include <data/orbit.h>
+
+/**
+ * Struct for a bivariate linear approximation (BLA) of a number of consecutive
+ * perturbation steps, i.e., d_{n+l} = A d_n + B dc, which is valid as long as
+ * |d_n| < r.
+ */
+typedef struct {
+    double a_re;  /* Real part of coefficient of d_n */
+    double a_im;  /* Imaginary part of coefficient of d_n */
+    double b_re;  /* Real part of coefficient of dc */
+    double b_im;  /* Imaginary part of coefficient of dc */
+    double r_sqr; /* Square of validity radius */
+} BlaEntry;
+
+/**
+ * Struct for a hierarchical table of BLAs along a reference orbit. Level `k`
+ * contains the BLAs of the blocks of 2^k steps starting at the multiples of
+ * 2^k.
+ */
+typedef struct {
+    int num_levels;  /* Number of levels */
+    int *num;        /* Number of entries for each level */
+    BlaEntry **data; /* Entries for each level */
+    int cap;         /* Number of steps the table is allocated for */
+} BlaTable;
+
+/**
+ * Initializes fields in `bla`.
+ *
+ * @param[in] bla BlaTable object to initialize
+ */
+void
+BlaTable_init(BlaTable *bla);
+
+/**
+ * Clears fields in `bla`.
+ *
+ * @param[in] bla BlaTable object to clear
+ */
+void
+BlaTable_clear(BlaTable *bla);
+
+/**
+ * Computes the BLAs of `bla` along `orbit` for points whose difference to the
+ * reference point does not exceed `dc_max` in absolute value.
+ *
+ * @param[in] bla BlaTable object to compute
+ * @param[in] orbit ReferenceOrbit object to compute BLAs along
+ * @param[in] dc_max maximum absolute difference to reference point
+ */
+void
+BlaTable_compute(BlaTable *bla, const ReferenceOrbit *orbit, double dc_max);
+
+/**
+ * Returns the BLA of `bla` that skips the most steps starting at iteration
+ * `itrs` for a difference with absolute square `d_sqr` to the reference orbit
+ * while not skipping more than `max_steps` steps. The number of steps is
+ * written to `steps`. Returns NULL if no BLA is valid.
+ *
+ * @param[in] bla BlaTable object to look up
+ * @param[in] itrs iteration to start at
+ * @param[in] d_sqr absolute square of difference to reference orbit
+ * @param[in] max_steps maximum number of steps to skip
+ * @param[out] steps number of skipped steps
+ *
+ * @return BLA that skips the most steps, NULL if no BLA is valid
+ */
+inline const BlaEntry *
+BlaTable_lookup(
+  const BlaTable *bla, int itrs, double d_sqr, int max_steps, int *steps
+)
+{
+    if (bla->num_levels == 0 || itrs >= bla->num[0]
+        || !(d_sqr < bla->data[0][itrs].r_sqr))
+    {
+        return NULL;
+    }
+
+    /* Validity radii shrink with increasing level */
+    int k = 1;
+    while (k < bla->num_levels) {
+        const int size = 1 << k;
+        const int j = itrs >> k;
+        if (size > max_steps || (itrs & (size - 1)) != 0 || j >= bla->num[k]
+            || !(d_sqr < bla->data[k][j].r_sqr))
+        {
+            break;
+        }
+        ++k;
+    }
+
+    --k;
+    *steps = 1 << k;
+    return &bla->data[k][itrs >> k];
+}
+
+#endif /* MANDELBROT_DATA_BLA_H_INCLUDED */
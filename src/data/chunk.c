@@ -1,47 +1,128 @@
 #include <data/chunk.h>
 
+#include <limits.h>
+
+#include <cutil/std/math.h>
 #include <cutil/std/stdlib.h>
 #include <cutil/util/macro.h>
 
 #include <data/image.h>
 #include <visuals/palette.h>
 
-static void
-_pixelChunk_shift_aux(
-  int num_chnks, int shift, int *p_idx, enum ChunkState *p_state
-)
+extern inline int
+PixelChunk_get_idx_re(
+  const PixelChunk *chunk, const ChunkData *chunks, int idx_px_re
+);
+
+extern inline int
+PixelChunk_get_idx_im(
+  const PixelChunk *chunk, const ChunkData *chunks, int idx_px_im
+);
+
+/**
+ * Returns `num` divided by `div` rounded towards negative infinity.
+ */
+static inline int
+_chunkData_floor_div(int num, int div)
 {
-    if (shift == 0) {
-        return;
-    }
-    const int idx_old = *p_idx;
-    const int new_idx_raw = idx_old - shift;
-    const int new_idx = *p_idx = (new_idx_raw + num_chnks) % num_chnks;
+    const int quot = num / div;
+    return (num % div < 0) ? quot - 1 : quot;
+}
 
-    /* In case of overflow, chunk has to be recreated */
-    if (new_idx != new_idx_raw) {
-        *p_state = CHUNK_STATE_INVALID;
-    }
+/**
+ * Returns the non-negative remainder of `num` divided by `div`.
+ */
+static inline int
+_chunkData_mod(int num, int div)
+{
+    const int rem = num % div;
+    return (rem < 0) ? rem + div : rem;
 }
 
-static inline void
-_pixelChunk_shift_re(PixelChunk *chunk, const ChunkData *chunks, int shift)
+static inline int
+_chunkData_clamp(int idx, int num)
 {
-    _pixelChunk_shift_aux(chunks->num_re, shift, &chunk->idx_re, &chunk->state);
+    return (idx < 0) ? 0 : (idx > num) ? num : idx;
+}
+
+/**
+ * Returns the index of the first chunk stored in the chunk grid if the image
+ * starts at the pixel `org`, i.e., the one `CHUNK_MARGIN` chunks before the
+ * chunk containing the origin of the image.
+ */
+static inline int
+_chunkData_get_first_idx(int num_px, int org)
+{
+    return _chunkData_floor_div(org, num_px) - CHUNK_MARGIN;
+}
+
+/**
+ * Returns the index of the chunk in the chunk grid that has to be stored at
+ * `idx_chnk` mod `num_chnks` if the image starts at the pixel `org`.
+ */
+static inline int
+_chunkData_get_stored_idx(int idx_chnk, int num_chnks, int num_px, int org)
+{
+    const int idx_first = _chunkData_get_first_idx(num_px, org);
+    return idx_first + _chunkData_mod(idx_chnk - idx_first, num_chnks);
+}
+
+/**
+ * Returns the `pos`-th of `num` indices when those below `split` are traversed
+ * upwards and the others downwards, i.e., towards the index `split` from the
+ * outside in. Zooming in moves pixels inwards, zooming out moves them outwards,
+ * so the traversal is reversed for the latter.
+ */
+static inline int
+_chunkData_get_ordered_idx(int pos, int num, int split, int stages)
+{
+    const int pos_ordered = (stages > 0) ? pos : num - 1 - pos;
+    return (pos_ordered < split) ? pos_ordered
+                                 : num - 1 - (pos_ordered - split);
+}
+
+/**
+ * Writes the index of the pixel of the previous view closest to the pixel
+ * `idx` after zooming around `cntr` with the ratio `scale` of the new to the
+ * old units per pixel to `p_idx_src`. Returns whether both pixels coincide.
+ * Distances beyond any stored pixel are clamped to avoid overflows.
+ */
+static inline bool
+_chunkData_get_zoom_src(int idx, int cntr, double scale, int *p_idx_src)
+{
+    static const double offs_max = INT_MAX / 4;
+
+    const double offs = (idx - cntr) * scale;
+    const double offs_near = round(offs);
+    const double offs_clamped
+      = (offs_near > offs_max)    ? offs_max
+        : (offs_near < -offs_max) ? -offs_max
+                                  : offs_near;
+    *p_idx_src = cntr + (int) offs_clamped;
+    return (offs == offs_clamped);
 }
 
 static inline void
-_pixelChunk_shift_im(PixelChunk *chunk, const ChunkData *chunks, int shift)
+_pixelData_invalidate(PixelData *px)
 {
-    _pixelChunk_shift_aux(chunks->num_im, shift, &chunk->idx_im, &chunk->state);
+    px->state = PIXEL_STATE_INVALID;
+    px->itrs = PALETTE_INVALID_POS;
+    px->flags = PIXEL_FLAG_NONE;
 }
 
 void
 ChunkParams_init(ChunkParams *params, const Settings *settings)
 {
-    params->stride = settings->height;
-    params->num_px_re = settings->width / settings->num_chnks_re;
-    params->num_px_im = settings->height / settings->num_chnks_im;
+    const int num_px_re = params->num_px_re
+      = settings->width / settings->num_chnks_re;
+    const int num_px_im = params->num_px_im
+      = settings->height / settings->num_chnks_im;
+    const int num_spare = 2 * CHUNK_MARGIN + 1;
+    params->stride = settings->height + num_spare * num_px_im;
+    params->num_px_tot
+      = (settings->width + num_spare * num_px_re) * params->stride;
+
+    params->zoom_fac = settings->zoom_fac;
 }
 
 void
@@ -50,8 +131,15 @@ ChunkData_init(ChunkData *chunks, const Settings *settings, PixelData *px)
     ChunkParams *const params = &chunks->params;
     ChunkParams_init(params, settings);
 
-    const int num_chnks_re = chunks->num_re = settings->num_chnks_re;
-    const int num_chnks_im = chunks->num_im = settings->num_chnks_im;
+    const int num_spare = 2 * CHUNK_MARGIN + 1;
+    const int num_chnks_re = chunks->num_re
+      = settings->num_chnks_re + num_spare;
+    const int num_chnks_im = chunks->num_im
+      = settings->num_chnks_im + num_spare;
+    chunks->width = settings->width;
+    chunks->height = settings->height;
+    chunks->org_re = 0;
+    chunks->org_im = 0;
 
     const int dims = num_chnks_re * num_chnks_im;
     chunks->data = malloc(dims * sizeof *chunks->data);
@@ -64,9 +152,15 @@ ChunkData_init(ChunkData *chunks, const Settings *settings, PixelData *px)
         for (int idx_chnk_im = 0; idx_chnk_im < num_chnks_im; ++idx_chnk_im) {
             const int idx_chnk = idx_chnk_re * num_chnks_im + idx_chnk_im;
             PixelChunk *const chunk = &chunks->data[idx_chnk];
-            chunk->idx_re = idx_chnk_re;
-            chunk->idx_im = idx_chnk_im;
+            chunk->idx_re = _chunkData_get_stored_idx(
+              idx_chnk_re, num_chnks_re, num_px_re, 0
+            );
+            chunk->idx_im = _chunkData_get_stored_idx(
+              idx_chnk_im, num_chnks_im, num_px_im, 0
+            );
             chunk->state = CHUNK_STATE_INVALID;
+            chunk->step = 1;
+            chunk->skipped_itrs = 0;
 
             const int idx_px_re = idx_chnk_re * num_px_re;
             const int idx_px_im = idx_chnk_im * num_px_im;
@@ -82,6 +176,82 @@ ChunkData_clear(ChunkData *chunks)
     free(chunks->data);
 }
 
+PixelChunk *
+ChunkData_get_chunk(const ChunkData *chunks, int idx_re, int idx_im)
+{
+    const int idx_chnk_re = _chunkData_mod(idx_re, chunks->num_re);
+    const int idx_chnk_im = _chunkData_mod(idx_im, chunks->num_im);
+    PixelChunk *const chunk
+      = &chunks->data[idx_chnk_re * chunks->num_im + idx_chnk_im];
+    return (chunk->idx_re == idx_re && chunk->idx_im == idx_im) ? chunk : NULL;
+}
+
+PixelChunk *
+ChunkData_get_chunk_of_pixel(const ChunkData *chunks, int idx_re, int idx_im)
+{
+    const ChunkParams *const params = &chunks->params;
+    return ChunkData_get_chunk(
+      chunks, _chunkData_floor_div(idx_re + chunks->org_re, params->num_px_re),
+      _chunkData_floor_div(idx_im + chunks->org_im, params->num_px_im)
+    );
+}
+
+PixelData *
+ChunkData_get_pixel(const ChunkData *chunks, int idx_re, int idx_im)
+{
+    const PixelChunk *const chunk
+      = ChunkData_get_chunk_of_pixel(chunks, idx_re, idx_im);
+    if (chunk == NULL) {
+        return NULL;
+    }
+
+    const ChunkParams *const params = &chunks->params;
+    const int idx_px_re
+      = _chunkData_mod(idx_re + chunks->org_re, params->num_px_re);
+    const int idx_px_im
+      = _chunkData_mod(idx_im + chunks->org_im, params->num_px_im);
+    return &chunk->data[idx_px_re * params->stride + idx_px_im];
+}
+
+void
+ChunkData_shift(ChunkData *chunks, int shift_re, int shift_im)
+{
+    const ChunkParams *const params = &chunks->params;
+    const int num_chnks_re = chunks->num_re;
+    const int num_chnks_im = chunks->num_im;
+    const int org_re = chunks->org_re += shift_re;
+    const int org_im = chunks->org_im += shift_im;
+
+    const int num_tot = num_chnks_re * num_chnks_im;
+    for (int idx = 0; idx < num_tot; ++idx) {
+        PixelChunk *const chunk = &chunks->data[idx];
+        const int idx_re = _chunkData_get_stored_idx(
+          chunk->idx_re, num_chnks_re, params->num_px_re, org_re
+        );
+        const int idx_im = _chunkData_get_stored_idx(
+          chunk->idx_im, num_chnks_im, params->num_px_im, org_im
+        );
+        if (idx_re == chunk->idx_re && idx_im == chunk->idx_im) {
+            continue;
+        }
+
+        /* Chunk has left the image and is reused for one entering it */
+        chunk->idx_re = idx_re;
+        chunk->idx_im = idx_im;
+        PixelChunk_invalidate_all_pixels(chunk, chunks);
+    }
+}
+
+bool
+PixelChunk_is_visible(const PixelChunk *chunk, const ChunkData *chunks)
+{
+    const ChunkParams *const params = &chunks->params;
+    const int idx_re_min = PixelChunk_get_idx_re(chunk, chunks, 0);
+    const int idx_im_min = PixelChunk_get_idx_im(chunk, chunks, 0);
+    return idx_re_min > -params->num_px_re && idx_re_min < chunks->width
+           && idx_im_min > -params->num_px_im && idx_im_min < chunks->height;
+}
+
 void
 PixelChunk_invalidate_all_pixels(PixelChunk *chunk, const ChunkData *chunks)
 {
@@ -93,9 +263,7 @@ PixelChunk_invalidate_all_pixels(PixelChunk *chunk, const ChunkData *chunks)
         for (int idx_px_im = 0; idx_px_im < num_px_im; ++idx_px_im) {
             const int stride = params->stride;
             const int idx_px = idx_px_re * stride + idx_px_im;
-            PixelData *const px = &chunk->data[idx_px];
-            px->state = PIXEL_STATE_INVALID;
-            px->itrs = PALETTE_INVALID_POS;
+            _pixelData_invalidate(&chunk->data[idx_px]);
         }
     }
 
@@ -103,48 +271,119 @@ PixelChunk_invalidate_all_pixels(PixelChunk *chunk, const ChunkData *chunks)
 }
 
 void
-PixelChunk_zoom(PixelChunk *chunk, const ChunkData *chunks, int stages)
+ChunkData_zoom(ChunkData *chunks, int stages)
 {
-    CUTIL_UNUSED(chunk);
-    CUTIL_UNUSED(chunks);
-    CUTIL_UNUSED(stages);
-}
+    const ChunkParams *const params = &chunks->params;
+    const int num_px_re = params->num_px_re;
+    const int num_px_im = params->num_px_im;
+    const int num_chnks_re = chunks->num_re;
+    const int num_chnks_im = chunks->num_im;
 
-void
-PixelChunk_callback_update(
-  PixelChunk *chunk, const ChunkData *chunks, const void *vparams
-)
-{
-    CUTIL_UNUSED(chunks);
-    const ImageData *const imgdata = vparams;
-    ImageData_update_chunk(imgdata, chunk);
+    const int idx_first_re
+      = _chunkData_get_first_idx(num_px_re, chunks->org_re);
+    const int idx_first_im
+      = _chunkData_get_first_idx(num_px_im, chunks->org_im);
+
+    /* Chunks containing the centre pixel */
+    const int idx_cntr_re = chunks->width / 2 + chunks->org_re;
+    const int idx_cntr_im = chunks->height / 2 + chunks->org_im;
+    const int split_re
+      = _chunkData_floor_div(idx_cntr_re, num_px_re) - idx_first_re;
+    const int split_im
+      = _chunkData_floor_div(idx_cntr_im, num_px_im) - idx_first_im;
+
+    /* Pixels are copied in place, so sources must not be overwritten before */
+    for (int pos_re = 0; pos_re < num_chnks_re; ++pos_re) {
+        const int idx_chnk_re = idx_first_re
+          + _chunkData_get_ordered_idx(pos_re, num_chnks_re, split_re, stages);
+        for (int pos_im = 0; pos_im < num_chnks_im; ++pos_im) {
+            const int idx_chnk_im = idx_first_im
+              + _chunkData_get_ordered_idx(
+                pos_im, num_chnks_im, split_im, stages
+              );
+            PixelChunk *const chunk
+              = ChunkData_get_chunk(chunks, idx_chnk_re, idx_chnk_im);
+            PixelChunk_zoom(chunk, chunks, stages);
+        }
+    }
 }
 
 void
-PixelChunk_callback_shift(
-  PixelChunk *chunk, const ChunkData *chunks, const void *vparams
-)
+PixelChunk_zoom(PixelChunk *chunk, const ChunkData *chunks, int stages)
 {
-    const int *const shifts = vparams;
-    const int shift_re = shifts[0];
-    const int shift_im = shifts[1];
-
-    _pixelChunk_shift_re(chunk, chunks, shift_re);
-    _pixelChunk_shift_im(chunk, chunks, shift_im);
+    chunk->state = CHUNK_STATE_INVALID;
 
-    if (chunk->state == CHUNK_STATE_INVALID) {
+    const ChunkParams *const params = &chunks->params;
+    if (stages == 0 || params->zoom_fac <= 0.0) {
         PixelChunk_invalidate_all_pixels(chunk, chunks);
+        return;
+    }
+
+    const int stride = params->stride;
+    const int num_px_re = params->num_px_re;
+    const int num_px_im = params->num_px_im;
+    const int idx_cntr_re = chunks->width / 2;
+    const int idx_cntr_im = chunks->height / 2;
+    const int idx_min_re = PixelChunk_get_idx_re(chunk, chunks, 0);
+    const int idx_min_im = PixelChunk_get_idx_im(chunk, chunks, 0);
+    const int split_re = _chunkData_clamp(idx_cntr_re - idx_min_re, num_px_re);
+    const int split_im = _chunkData_clamp(idx_cntr_im - idx_min_im, num_px_im);
+
+    const double scale = pow(params->zoom_fac, stages);
+
+    /* Only powers of two scale the units per pixel exactly */
+    int exp = 0;
+    const bool is_scale_exact = (frexp(params->zoom_fac, &exp) == 0.5);
+
+    for (int pos_re = 0; pos_re < num_px_re; ++pos_re) {
+        const int idx_px_re
+          = _chunkData_get_ordered_idx(pos_re, num_px_re, split_re, stages);
+        int idx_src_re = 0;
+        const bool is_exact_re = _chunkData_get_zoom_src(
+          idx_min_re + idx_px_re, idx_cntr_re, scale, &idx_src_re
+        );
+        for (int pos_im = 0; pos_im < num_px_im; ++pos_im) {
+            const int idx_px_im
+              = _chunkData_get_ordered_idx(pos_im, num_px_im, split_im, stages);
+            int idx_src_im = 0;
+            const bool is_exact_im = _chunkData_get_zoom_src(
+              idx_min_im + idx_px_im, idx_cntr_im, scale, &idx_src_im
+            );
+            PixelData *const px = &chunk->data[idx_px_re * stride + idx_px_im];
+
+            const PixelData *const src_px
+              = ChunkData_get_pixel(chunks, idx_src_re, idx_src_im);
+            if (src_px == NULL
+                || (src_px->state != PIXEL_STATE_VALID
+                    && src_px->state != PIXEL_STATE_INTERPOLATED))
+            {
+                _pixelData_invalidate(px);
+                continue;
+            }
+
+            /* Other pixels show their nearest neighbour until iterated */
+            px->itrs = src_px->itrs;
+            if (is_scale_exact && is_exact_re && is_exact_im
+                && src_px->state == PIXEL_STATE_VALID)
+            {
+                px->state = PIXEL_STATE_VALID;
+                px->flags = src_px->flags;
+            } else {
+                px->state = PIXEL_STATE_INTERPOLATED;
+                px->flags = PIXEL_FLAG_NONE;
+            }
+        }
     }
 }
 
 void
-PixelChunk_callback_zoom(
+PixelChunk_callback_update(
   PixelChunk *chunk, const ChunkData *chunks, const void *vparams
 )
 {
-    const int stages = *(const int *) vparams;
-    PixelChunk_zoom(chunk, chunks, stages);
-    PixelChunk_invalidate_all_pixels(chunk, chunks);
+    CUTIL_UNUSED(chunks);
+    const ImageData *const imgdata = vparams;
+    ImageData_update_chunk(imgdata, chunk);
 }
 
 void
@@ -7,9 +7,17 @@
 #ifndef MANDELBROT_DATA_CHUNK_H_INCLUDED
 #define MANDELBROT_DATA_CHUNK_H_INCLUDED
 
+#include <cutil/std/stdbool.h>
+
 #include <app/settings.h>
 #include <data/pixel.h>
 
+/**
+ * Number of chunks stored beyond each side of the image, which are computed in
+ * advance while the image is idle
+ */
+#define CHUNK_MARGIN 1
+
 /**
  * Possible chunk states
  */
@@ -26,10 +34,14 @@ typedef struct {
     int stride;
     int num_px_re;
     int num_px_im;
+    int num_px_tot; /* Number of pixels stored for all chunks */
+    double zoom_fac; /* Factor of the units per pixel of one zoom stage */
 } ChunkParams;
 
 /**
- * Initializes fields in `params` according to `settings`.
+ * Initializes fields in `params` according to `settings`. The chunks store one
+ * more chunk per direction than fit into the image, so that the image may lie
+ * anywhere in the chunk grid, plus `CHUNK_MARGIN` chunks beyond each side.
  *
  * @param[in] params ChunkParams object to initialize
  * @param[in] settings Settings object to base initialization on
@@ -45,6 +57,8 @@ typedef struct {
     int idx_im;
     PixelData *data;
     enum ChunkState state;
+    int step; /* Distance of iterated pixels if interpolated */
+    int skipped_itrs;
 } PixelChunk;
 
 /**
@@ -54,11 +68,20 @@ typedef struct {
     ChunkParams params;
     int num_re;
     int num_im;
+    int width;  /* Width of the image in pixels */
+    int height; /* Height of the image in pixels */
+    int org_re; /* Position of the image in the chunk grid in pixels */
+    int org_im;
     PixelChunk *data;
 } ChunkData;
 
 /**
- * Initializes fields in `chunks` according to `settings` and `px`.
+ * Initializes fields in `chunks` according to `settings` and `px`, which has
+ * to hold `num_px_tot` pixels as given by ChunkParams_init. The chunks form a
+ * two-dimensional ring buffer, i.e., the chunk at the position (`idx_re`,
+ * `idx_im`) in the chunk grid is stored at (`idx_re` mod `num_re`, `idx_im` mod
+ * `num_im`). Initially, the image starts at the origin of the chunk grid and
+ * the stored chunks start `CHUNK_MARGIN` chunks before it.
  *
  * @param[in] chunks ChunkData object to initialize
  * @param[in] settings Settings object to base initialization on
@@ -75,6 +98,107 @@ ChunkData_init(ChunkData *chunks, const Settings *settings, PixelData *px);
 void
 ChunkData_clear(ChunkData *chunks);
 
+/**
+ * Returns the chunk in `chunks` at the position (`idx_re`, `idx_im`) in the
+ * chunk grid or NULL if that chunk is not stored.
+ *
+ * @param[in] chunks ChunkData object to get chunk from
+ * @param[in] idx_re real index of the chunk in the chunk grid
+ * @param[in] idx_im imaginary index of the chunk in the chunk grid
+ *
+ * @return chunk at the given position
+ */
+PixelChunk *
+ChunkData_get_chunk(const ChunkData *chunks, int idx_re, int idx_im);
+
+/**
+ * Returns the chunk in `chunks` containing the pixel (`idx_re`, `idx_im`) of
+ * the image or NULL if that chunk is not stored.
+ *
+ * @param[in] chunks ChunkData object to get chunk from
+ * @param[in] idx_re real index of the pixel in the image
+ * @param[in] idx_im imaginary index of the pixel in the image
+ *
+ * @return chunk containing the given pixel
+ */
+PixelChunk *
+ChunkData_get_chunk_of_pixel(const ChunkData *chunks, int idx_re, int idx_im);
+
+/**
+ * Returns the pixel (`idx_re`, `idx_im`) of the image in `chunks` or NULL if
+ * it is not stored. Pixels outside of the image may be stored as well.
+ *
+ * @param[in] chunks ChunkData object to get pixel from
+ * @param[in] idx_re real index of the pixel in the image
+ * @param[in] idx_im imaginary index of the pixel in the image
+ *
+ * @return pixel at the given position
+ */
+PixelData *
+ChunkData_get_pixel(const ChunkData *chunks, int idx_re, int idx_im);
+
+/**
+ * Shifts the image in `chunks` by `shift_re` and `shift_im` pixels. Only the
+ * origin of the image in the chunk grid moves. Chunks that leave the image
+ * and its margin are reused for those entering it and invalidated, all others,
+ * in particular margin chunks computed in advance, are kept.
+ *
+ * @param[in] chunks ChunkData object to shift
+ * @param[in] shift_re real shift in pixels
+ * @param[in] shift_im imaginary shift in pixels
+ */
+void
+ChunkData_shift(ChunkData *chunks, int shift_re, int shift_im);
+
+/**
+ * Returns the real index in the image of the pixel column `idx_px_re` of
+ * `chunk`, which is outside of [0, `width`) for columns beyond the image.
+ *
+ * @param[in] chunk PixelChunk object containing the column
+ * @param[in] chunks ChunkData object to get chunk parameters from
+ * @param[in] idx_px_re real index of the pixel in the chunk
+ *
+ * @return real index of the pixel in the image
+ */
+inline int
+PixelChunk_get_idx_re(
+  const PixelChunk *chunk, const ChunkData *chunks, int idx_px_re
+)
+{
+    const int num_px_re = chunks->params.num_px_re;
+    return chunk->idx_re * num_px_re + idx_px_re - chunks->org_re;
+}
+
+/**
+ * Returns the imaginary index in the image of the pixel row `idx_px_im` of
+ * `chunk`, which is outside of [0, `height`) for rows beyond the image.
+ *
+ * @param[in] chunk PixelChunk object containing the row
+ * @param[in] chunks ChunkData object to get chunk parameters from
+ * @param[in] idx_px_im imaginary index of the pixel in the chunk
+ *
+ * @return imaginary index of the pixel in the image
+ */
+inline int
+PixelChunk_get_idx_im(
+  const PixelChunk *chunk, const ChunkData *chunks, int idx_px_im
+)
+{
+    const int num_px_im = chunks->params.num_px_im;
+    return chunk->idx_im * num_px_im + idx_px_im - chunks->org_im;
+}
+
+/**
+ * Returns whether any pixel of `chunk` lies in the image of `chunks`.
+ *
+ * @param[in] chunk PixelChunk object to check
+ * @param[in] chunks ChunkData object to get chunk parameters from
+ *
+ * @return true if `chunk` is (partially) visible, false otherwise
+ */
+bool
+PixelChunk_is_visible(const PixelChunk *chunk, const ChunkData *chunks);
+
 /**
  * Invalidates all pixels in `chunk` in `chunks`.
  *
@@ -84,11 +208,27 @@ ChunkData_clear(ChunkData *chunks);
 void
 PixelChunk_invalidate_all_pixels(PixelChunk *chunk, const ChunkData *chunks);
 
+/**
+ * Zooms all chunks in `chunks` by `stages` where each stage corresponds to
+ * zooming by the zoom factor. A positive zoom stage amounts to zooming in.
+ * Pixels that remain on the lattice of the new view keep their values. All
+ * others show the value of the nearest pixel of the previous view and are
+ * marked as interpolated until they are iterated, or are invalidated if there
+ * is no such pixel.
+ *
+ * @param[in] chunks ChunkData object to zoom
+ * @param[in] stages zoom stages
+ */
+void
+ChunkData_zoom(ChunkData *chunks, int stages);
+
 /**
  * Zooms `chunk` in `chunks` by `stages` where each stage corresponds to zooming
- * by the zoom factor. A positive zoom stage amounts to zooming in. Currently,
- * this function is a no op as this functionality is handled by setting the
- * units per pixel.
+ * by the zoom factor. A positive zoom stage amounts to zooming in. The pixels
+ * of the previous view closest to the pixels of the new one are copied from the
+ * chunks closer to the centre when zooming in and farther from it when zooming
+ * out, so chunks have to be zoomed in that order and not concurrently (see
+ * ChunkData_zoom).
  *
  * @param[in] chunk PixelChunk object to zoom
  * @param[in] chunks ChunkData object to get chunk parameters from
@@ -121,34 +261,6 @@ PixelChunk_callback_update(
   PixelChunk *chunk, const ChunkData *chunks, const void *vparams
 );
 
-/**
- * Shifts `chunk` according to `vparams`, which is an integer array with two
- * elements containing the real and imaginary shifts as its first and second
- * element, respectively.
- *
- * @param[in] chunk PixelChunk object to shift
- * @param[in] chunks ChunkData object to get chunk parameters from
- * @param[in] vparams integer array of shifts
- */
-void
-PixelChunk_callback_shift(
-  PixelChunk *chunk, const ChunkData *chunks, const void *vparams
-);
-
-/**
- * Zooms `chunk` according to `vparams`, which is an integer describing the
- * 'zoom stages' where each stage corresponds to zooming by the zoom factor. A
- * positive zoom stage amounts to zooming in.
- *
- * @param[in] chunk PixelChunk object to zoom
- * @param[in] chunks ChunkData object to get chunk parameters from
- * @param[in] vparams zoom stage
- */
-void
-PixelChunk_callback_zoom(
-  PixelChunk *chunk, const ChunkData *chunks, const void *vparams
-);
-
 /**
  * Resets, i.e., invalidates, all pixels of `chunk`.
  *
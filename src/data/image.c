@@ -1,5 +1,7 @@
 #include <data/image.h>
 
+#include <float.h>
+
 #include <SDL2/SDL_timer.h>
 #include <gmp.h>
 #include <omp.h>
@@ -9,10 +11,17 @@
 #include <cutil/std/stdbool.h>
 #include <cutil/std/stdio.h>
 #include <cutil/std/stdlib.h>
+#include <cutil/std/string.h>
 #include <cutil/util/macro.h>
 
 #include <app/app.h>
+#include <data/bla.h>
+#include <data/interior.h>
+#include <data/nucleus.h>
+#include <data/orbit.h>
 #include <data/pixel.h>
+#include <util/floatexp.h>
+#include <util/multidouble.h>
 #include <util/sys.h>
 #include <util/util.h>
 #include <visuals/palette.h>
@@ -20,6 +29,54 @@
 
 #define INITIAL_PRECISION GMP_LIMB_BITS
 #define ITERATION_CUTOFF_ABSOLUTE_VALUE 2.0
+#define DOUBLE_GUARD_BITS 11
+#define PERTURBATION_GUARD_BITS 64
+#define GLITCH_MAX_SECONDARY_REFERENCES 8
+
+/**
+ * Number of guard bits added per doubling of the maximum number of iterations,
+ * as rounding errors are amplified along the orbits of pixels close to the set
+ */
+#define ITERATION_GUARD_BITS 2
+
+/**
+ * Number of positions per dimension at which interior components are searched
+ * for, maximum period of these components and minimum radius (in pixels) of
+ * their disks worth caching
+ */
+#define INTERIOR_SEARCH_GRID 8
+#define INTERIOR_MAX_PERIOD 256
+#define INTERIOR_MIN_RADIUS_PX 2.0
+
+/**
+ * Minimum number of pixels per dimension of rectangles that are subdivided
+ * when filling chunks; smaller rectangles are left to be iterated row by row,
+ * which keeps the vectorized segments long
+ */
+#define FILL_MIN_SIZE 8
+
+/**
+ * Maximum deviation (in pixels) of the conjugates of the pixel rows from other
+ * pixel rows for the image to be mirrored at the real axis
+ */
+#define MIRROR_TOLERANCE_PX 1e-6
+
+/**
+ * Distance of the pixels iterated in the first pass of progressive rendering;
+ * each further pass halves it until all pixels are iterated. As the passes add
+ * work, they are skipped after images that were completed within one frame.
+ */
+#define PROGRESSIVE_MAX_STEP 8
+
+/**
+ * Possible modes of filling chunks
+ */
+enum FillMode {
+    FILL_MODE_OFF = 0,  /* Iterate every pixel */
+    FILL_MODE_BORDER,   /* Fill rectangles whose border has one value */
+    FILL_MODE_INTERVAL, /* Fill rectangles proven uniform by intervals */
+    FILL_MODE_VERIFY,   /* Both of the above, but check filled pixels */
+};
 
 /**
  * Possible data states
@@ -27,6 +84,7 @@
 enum DataState {
     DATA_STATE_WORKING = -1,
     DATA_STATE_IDLE = 0,
+    DATA_STATE_PREFETCHING, /* Image is complete, margin chunks are not */
 };
 
 /**
@@ -40,9 +98,54 @@ struct ImageData {
     PixelData *data;
     int tnum;
     PixelDataBuffer *tbuf;
+    enum PixelKernel kernel;
+    enum PixelKernel full_kernel;
+    enum PixelKernel forced_kernel;
+    bool is_kernel_forced;
+    enum FillMode fill_mode;
+    struct {
+        double cntr_re;
+        double cntr_im;
+        double upp;
+        double ref_offs_re;
+        double ref_offs_im;
+        double tol;        /* Tolerance of the cycle detection */
+        double series_tol; /* Tolerance of the series approximation */
+        bool is_resolved;  /* Whether doubles resolve all positions */
+    } view_d;
+    struct {
+        long double cntr_re;
+        long double cntr_im;
+        long double upp;
+    } view_ld;
+    struct {
+        FloatExp upp;
+        FloatExp ref_offs_re;
+        FloatExp ref_offs_im;
+    } view_fe;
+    struct {
+        DoubleDouble cntr_re;
+        DoubleDouble cntr_im;
+        DoubleDouble upp;
+    } view_dd;
+    struct {
+        QuadDouble cntr_re;
+        QuadDouble cntr_im;
+        QuadDouble upp;
+    } view_qd;
+    ReferenceOrbit orbit;
+    bool is_orbit_valid;
+    Nucleus nucleus;
+    BlaTable bla;
+    bool use_bla;
+    ReferenceOrbit *torbit;
+    InteriorCache interior;
+    int mirror_offs; /* Sum of indices of conjugate rows (-1 if none) */
     ChunkData chunks;
     float *framebuf;
     enum DataState state;
+    int step;       /* Distance of pixels iterated in the current pass */
+    int num_frames; /* Number of frames spent on the current image */
     uint64_t target_ticks;
     char *view_fname;
 };
@@ -61,16 +164,29 @@ _imageData_init_view(ImageData *imgdata)
     View_fill_from_Settings(imgdata->view, settings);
 }
 
+/**
+ * Returns the number of pixels stored for all chunks of `imgdata`, which
+ * exceeds the size of the image by the spare and margin chunks.
+ */
+static int
+_imageData_get_num_px(const ImageData *imgdata)
+{
+    ChunkParams params;
+    ChunkParams_init(&params, imgdata->settings);
+    return params.num_px_tot;
+}
+
 static void
 _imageData_init_data(ImageData *imgdata)
 {
     const Settings *const settings = imgdata->settings;
-    const int num_tot = settings->width * settings->height;
+    const int num_tot = _imageData_get_num_px(imgdata);
     imgdata->data = malloc(num_tot * sizeof *imgdata->data);
     for (int i = 0; i < num_tot; ++i) {
         PixelData_init(&imgdata->data[i]);
     }
-    imgdata->framebuf = malloc(num_tot * sizeof *imgdata->framebuf);
+    const int num_px = settings->width * settings->height;
+    imgdata->framebuf = malloc(num_px * sizeof *imgdata->framebuf);
 }
 
 static void
@@ -89,6 +205,29 @@ _imageData_init_tbuf(ImageData *imgdata)
     mpf_clear(max_sqr);
 }
 
+static void
+_imageData_init_orbit(ImageData *imgdata)
+{
+    ReferenceOrbit_init(&imgdata->orbit);
+    imgdata->is_orbit_valid = false;
+    Nucleus_init(&imgdata->nucleus);
+    BlaTable_init(&imgdata->bla);
+    imgdata->use_bla = true;
+
+    /* Secondary reference orbits for glitch correction */
+    const int tnum = imgdata->tnum;
+    imgdata->torbit = malloc(tnum * sizeof *imgdata->torbit);
+    for (int i = 0; i < tnum; ++i) {
+        ReferenceOrbit_init(&imgdata->torbit[i]);
+    }
+}
+
+static void
+_imageData_init_interior(ImageData *imgdata)
+{
+    InteriorCache_init(&imgdata->interior);
+}
+
 static void
 _imageData_init_chunks(ImageData *imgdata)
 {
@@ -98,182 +237,2039 @@ _imageData_init_chunks(ImageData *imgdata)
     ChunkData_init(chunks, settings, data);
 }
 
+/**
+ * Sets the path of the view file of `imgdata`, which lies in the environment
+ * path of the app or, if no app is running, in the working directory.
+ */
 static void
 _imageData_init_view_fname(ImageData *imgdata)
 {
-    const char *const path = App_get_env_path();
+    const char *const env_path = App_get_env_path();
+    const char *const path = (env_path != NULL) ? env_path : ".";
     char *const fname = imgdata->settings->view_file;
     const size_t bufsiz = snprintf(NULL, 0, "%s/%s", path, fname) + 1;
     imgdata->view_fname = malloc(bufsiz * sizeof *imgdata->view_fname);
     snprintf(imgdata->view_fname, bufsiz, "%s/%s", path, fname);
 }
 
-static ImageData *
-_imageData_alloc(const Settings *settings)
+/**
+ * Returns the number of mantissa bits needed to represent positions in the
+ * current view of `imgdata` safely, i.e., to resolve the distance of two pixels
+ * with DOUBLE_GUARD_BITS bits to spare.
+ */
+static int
+_imageData_get_position_bits(const ImageData *imgdata)
 {
-    ImageData *const imgdata = malloc(sizeof *imgdata);
+    const Settings *const settings = imgdata->settings;
+    const View *const view = imgdata->view;
 
-    imgdata->settings = Settings_duplicate(settings);
-    imgdata->prec = INITIAL_PRECISION;
-    mpf_set_default_prec(INITIAL_PRECISION);
+    long int exp_upp = 0;
+    CUTIL_UNUSED(mpf_get_d_2exp(&exp_upp, view->upp));
 
-    _imageData_init_mpf(imgdata);
-    _imageData_init_view(imgdata);
-    _imageData_init_data(imgdata);
-    _imageData_init_tbuf(imgdata);
-    _imageData_init_chunks(imgdata);
-    _imageData_init_view_fname(imgdata);
+    const int width = settings->width;
+    const int height = settings->height;
+    const int num_px = (width > height) ? width : height;
+    const double extent = fabs(mpf_get_d(view->cntr_re))
+                        + fabs(mpf_get_d(view->cntr_im))
+                        + 0.5 * num_px * mpf_get_d(view->upp);
+    int exp_extent = 0;
+    CUTIL_UNUSED(frexp(extent, &exp_extent));
 
-    imgdata->state = DATA_STATE_WORKING;
-    imgdata->target_ticks = 0;
+    return (int) (exp_extent - exp_upp) + DOUBLE_GUARD_BITS;
+}
 
-    return imgdata;
+/**
+ * Returns the number of guard bits for the maximum number of iterations of
+ * `imgdata`, i.e., ITERATION_GUARD_BITS bits per doubling.
+ */
+static int
+_imageData_get_iteration_bits(const ImageData *imgdata)
+{
+    int exp_itrs = 0;
+    CUTIL_UNUSED(frexp(imgdata->settings->max_itrs, &exp_itrs));
+    return ITERATION_GUARD_BITS * exp_itrs;
+}
+
+/**
+ * Returns the number of mantissa bits needed to iterate positions in the
+ * current view of `imgdata` without changing the image, i.e., the bits needed
+ * to represent them plus the guard bits for the number of iterations.
+ */
+static int
+_imageData_get_required_bits(const ImageData *imgdata)
+{
+    return _imageData_get_position_bits(imgdata)
+           + _imageData_get_iteration_bits(imgdata);
+}
+
+/**
+ * Returns the maximum relative difference of series approximation and directly
+ * perturbed orbit for iterations to be skipped, so that the error of the
+ * largest difference to the reference keeps the guard bits of the view of
+ * `imgdata` below the distance of two pixels.
+ */
+static double
+_imageData_get_series_tolerance(const ImageData *imgdata)
+{
+    const Settings *const settings = imgdata->settings;
+    const int num_px = (settings->width > settings->height) ? settings->width
+                                                            : settings->height;
+    int exp_num_px = 0;
+    CUTIL_UNUSED(frexp(num_px, &exp_num_px));
+    return ldexp(
+      1.0,
+      -(DOUBLE_GUARD_BITS + _imageData_get_iteration_bits(imgdata) + exp_num_px)
+    );
+}
+
+/**
+ * Returns the precision for the current view of `imgdata`, which suffices for
+ * the position of the view and the bits required to iterate its pixels, so
+ * that the mpf and fixed-limb kernels and the reference orbits keep the image
+ * as well.
+ */
+static mp_bitcnt_t
+_imageData_get_new_prec(const ImageData *imgdata)
+{
+    const mp_bitcnt_t prec = Util_calculate_new_prec(imgdata->view->upp);
+    const mp_bitcnt_t bits = _imageData_get_required_bits(imgdata);
+    const mp_bitcnt_t prec_bits
+      = ((bits + GMP_LIMB_BITS - 1) / GMP_LIMB_BITS) * GMP_LIMB_BITS;
+    return (prec_bits > prec) ? prec_bits : prec;
+}
+
+/**
+ * Returns whether the differences of the positions in the current view of
+ * `imgdata` to the reference point can be represented by doubles without
+ * running into subnormal numbers.
+ */
+static bool
+_imageData_is_perturbation_safe(const ImageData *imgdata)
+{
+    const View *const view = imgdata->view;
+
+    long int exp_upp = 0;
+    CUTIL_UNUSED(mpf_get_d_2exp(&exp_upp, view->upp));
+
+    return (exp_upp > DBL_MIN_EXP + PERTURBATION_GUARD_BITS);
+}
+
+/**
+ * Names of the kernels as used in Settings
+ */
+static const char *const KERNEL_NAMES[] = {
+  [PIXEL_KERNEL_MPF] = "mpf",
+  [PIXEL_KERNEL_DOUBLE] = "double",
+  [PIXEL_KERNEL_PERTURBATION] = "perturbation",
+  [PIXEL_KERNEL_FLOATEXP] = "floatexp",
+  [PIXEL_KERNEL_DDOUBLE] = "double-double",
+  [PIXEL_KERNEL_QDOUBLE] = "quad-double",
+  [PIXEL_KERNEL_LDOUBLE] = "long-double",
+  [PIXEL_KERNEL_FIXED] = "fixed",
+};
+
+#define KERNEL_NUM ((int) ((sizeof KERNEL_NAMES) / (sizeof *KERNEL_NAMES)))
+#define KERNEL_NAME_AUTO "auto"
+
+static const char *
+_imageData_get_kernel_name(enum PixelKernel kernel)
+{
+    return KERNEL_NAMES[kernel];
 }
 
+/**
+ * Reads the kernel set in the Settings of `imgdata`. Unknown names are
+ * treated like KERNEL_NAME_AUTO, i.e., the kernel is chosen automatically.
+ */
 static void
-_imageData_clear_mpf(ImageData *imgdata)
+_imageData_init_kernel(ImageData *imgdata)
 {
-    mpf_clear(imgdata->action_buf);
+    const char *const name = imgdata->settings->kernel;
+
+    imgdata->kernel = PIXEL_KERNEL_MPF;
+    imgdata->full_kernel = PIXEL_KERNEL_MPF;
+    imgdata->forced_kernel = PIXEL_KERNEL_MPF;
+    imgdata->is_kernel_forced = false;
+    if (name == NULL || strcmp(name, KERNEL_NAME_AUTO) == 0) {
+        return;
+    }
+
+    for (int idx = 0; idx < KERNEL_NUM; ++idx) {
+        if (strcmp(name, KERNEL_NAMES[idx]) == 0) {
+            imgdata->forced_kernel = (enum PixelKernel) idx;
+            imgdata->is_kernel_forced = true;
+            return;
+        }
+    }
+
+    cutil_log_warn("Unknown kernel '%s', choosing automatically", name);
 }
 
+/**
+ * Names of the fill modes as used in Settings
+ */
+static const char *const FILL_MODE_NAMES[] = {
+  [FILL_MODE_OFF] = "off",
+  [FILL_MODE_BORDER] = "border",
+  [FILL_MODE_INTERVAL] = "interval",
+  [FILL_MODE_VERIFY] = "verify",
+};
+
+#define FILL_MODE_NUM                                                          \
+    ((int) ((sizeof FILL_MODE_NAMES) / (sizeof *FILL_MODE_NAMES)))
+
+/**
+ * Reads the fill mode set in the Settings of `imgdata`. Unknown names are
+ * treated like "border".
+ */
 static void
-_imageData_clear_view(ImageData *imgdata)
+_imageData_init_fill_mode(ImageData *imgdata)
 {
-    View_free(imgdata->view);
+    const char *const name = imgdata->settings->fill;
+
+    imgdata->fill_mode = FILL_MODE_BORDER;
+    if (name == NULL) {
+        return;
+    }
+
+    for (int idx = 0; idx < FILL_MODE_NUM; ++idx) {
+        if (strcmp(name, FILL_MODE_NAMES[idx]) == 0) {
+            imgdata->fill_mode = (enum FillMode) idx;
+            return;
+        }
+    }
+
+    cutil_log_warn("Unknown fill mode '%s', filling borders", name);
+}
+
+static bool
+_imageData_is_kernel_perturbative(enum PixelKernel kernel)
+{
+    return (kernel == PIXEL_KERNEL_PERTURBATION
+            || kernel == PIXEL_KERNEL_FLOATEXP);
+}
+
+/**
+ * Returns whether `kernel` yields correct results for the current view of
+ * `imgdata`, where positions need `bits` mantissa bits.
+ */
+static bool
+_imageData_is_kernel_correct(
+  const ImageData *imgdata, enum PixelKernel kernel, int bits
+)
+{
+    switch (kernel) {
+    case PIXEL_KERNEL_DOUBLE:
+        return (bits <= DBL_MANT_DIG);
+    case PIXEL_KERNEL_LDOUBLE:
+        return (bits <= LDBL_MANT_DIG);
+    case PIXEL_KERNEL_DDOUBLE:
+        return (bits <= 2 * DBL_MANT_DIG);
+    case PIXEL_KERNEL_QDOUBLE:
+        return (bits <= 4 * DBL_MANT_DIG);
+    case PIXEL_KERNEL_FIXED:
+        return (PixelData_get_fixed_limbs(imgdata->prec) != 0);
+    case PIXEL_KERNEL_PERTURBATION:
+        return _imageData_is_perturbation_safe(imgdata);
+    case PIXEL_KERNEL_FLOATEXP:
+    case PIXEL_KERNEL_MPF:
+    default:
+        return true;
+    }
+}
+
+/**
+ * Estimated costs of one iteration in nanoseconds, measured on x86-64 with
+ * AVX2. Only their ratios matter. The double kernel is vectorized, the costs
+ * of the fixed-limb and mpf kernels grow with the number of limbs and the
+ * costs of the perturbative kernels take the iterations skipped by the series
+ * approximation and BLAs into account.
+ */
+#define KERNEL_COST_DOUBLE 1.5
+#define KERNEL_COST_LDOUBLE 6.5
+#define KERNEL_COST_DDOUBLE 35.0
+#define KERNEL_COST_QDOUBLE 240.0
+#define KERNEL_COST_PERTURBATION 5.0
+#define KERNEL_COST_FLOATEXP 70.0
+#define KERNEL_COST_FIXED 100.0
+#define KERNEL_COST_FIXED_PER_LIMB 30.0
+#define KERNEL_COST_MPF 350.0
+#define KERNEL_COST_MPF_PER_LIMB 50.0
+
+/**
+ * Returns the estimated cost of a frame of `imgdata` computed by `kernel`, as
+ * if every pixel took the maximum number of iterations. The cost of the
+ * perturbative kernels includes the reference orbit in mpf.
+ */
+static double
+_imageData_get_kernel_cost(const ImageData *imgdata, enum PixelKernel kernel)
+{
+    const Settings *const settings = imgdata->settings;
+    const double max_itrs = settings->max_itrs;
+    const double num_itrs = max_itrs * settings->width * settings->height;
+
+    const double limbs = (imgdata->prec + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS;
+    const double cost_mpf = KERNEL_COST_MPF + KERNEL_COST_MPF_PER_LIMB * limbs;
+    const double cost_fixed
+      = KERNEL_COST_FIXED + KERNEL_COST_FIXED_PER_LIMB * limbs;
+
+    switch (kernel) {
+    case PIXEL_KERNEL_DOUBLE:
+        return num_itrs * KERNEL_COST_DOUBLE;
+    case PIXEL_KERNEL_LDOUBLE:
+        return num_itrs * KERNEL_COST_LDOUBLE;
+    case PIXEL_KERNEL_DDOUBLE:
+        return num_itrs * KERNEL_COST_DDOUBLE;
+    case PIXEL_KERNEL_QDOUBLE:
+        return num_itrs * KERNEL_COST_QDOUBLE;
+    case PIXEL_KERNEL_FIXED:
+        return num_itrs * cost_fixed;
+    case PIXEL_KERNEL_PERTURBATION:
+        return num_itrs * KERNEL_COST_PERTURBATION + max_itrs * cost_mpf;
+    case PIXEL_KERNEL_FLOATEXP:
+        return num_itrs * KERNEL_COST_FLOATEXP + max_itrs * cost_mpf;
+    case PIXEL_KERNEL_MPF:
+    default:
+        return num_itrs * cost_mpf;
+    }
+}
+
+/**
+ * Returns the kernel with the least estimated cost among all kernels that
+ * yield correct results for the current view of `imgdata`. Perturbative
+ * kernels are only taken into account if `allow_perturbative` is set.
+ */
+static enum PixelKernel
+_imageData_choose_cheapest_kernel(
+  const ImageData *imgdata, bool allow_perturbative
+)
+{
+    const int bits = _imageData_get_required_bits(imgdata);
+
+    enum PixelKernel best_kernel = PIXEL_KERNEL_MPF;
+    double best_cost = HUGE_VAL;
+    for (int idx = 0; idx < KERNEL_NUM; ++idx) {
+        const enum PixelKernel kernel = (enum PixelKernel) idx;
+        if (!allow_perturbative && _imageData_is_kernel_perturbative(kernel)) {
+            continue;
+        }
+        if (!_imageData_is_kernel_correct(imgdata, kernel, bits)) {
+            continue;
+        }
+        const double cost = _imageData_get_kernel_cost(imgdata, kernel);
+        if (cost < best_cost) {
+            best_kernel = kernel;
+            best_cost = cost;
+        }
+    }
+
+    return best_kernel;
+}
+
+/**
+ * Chooses the kernel for the pixel iterations of the current view of
+ * `imgdata`, i.e., the kernel set in Settings if it yields correct results and
+ * the cheapest one otherwise. The reason for the choice is written to
+ * `p_reason`.
+ */
+static enum PixelKernel
+_imageData_choose_kernel(const ImageData *imgdata, const char **p_reason)
+{
+    if (imgdata->is_kernel_forced) {
+        const enum PixelKernel kernel = imgdata->forced_kernel;
+        const int bits = _imageData_get_required_bits(imgdata);
+        if (_imageData_is_kernel_correct(imgdata, kernel, bits)) {
+            *p_reason = "set in settings";
+            return kernel;
+        }
+        *p_reason = "kernel set in settings cannot resolve view";
+    } else {
+        *p_reason = "cheapest that resolves view";
+    }
+
+    return _imageData_choose_cheapest_kernel(imgdata, true);
+}
+
+/**
+ * Chooses the kernel for pixels that have to be iterated in full precision,
+ * i.e., without perturbation, as the cheapest one that resolves the current
+ * view of `imgdata`.
+ */
+static enum PixelKernel
+_imageData_choose_full_kernel(const ImageData *imgdata)
+{
+    return _imageData_choose_cheapest_kernel(imgdata, false);
+}
+
+/**
+ * Returns whether the point (`re`, `im`) lies inside the current view of
+ * `imgdata`.
+ */
+static bool
+_imageData_is_in_view(ImageData *imgdata, mpf_srcptr re, mpf_srcptr im)
+{
+    const Settings *const settings = imgdata->settings;
+    const View *const view = imgdata->view;
+
+    /* Offsets of point in pixels */
+    const mpf_ptr buf = imgdata->action_buf;
+    mpf_sub(buf, re, view->cntr_re);
+    mpf_div(buf, buf, view->upp);
+    const double offs_re = fabs(mpf_get_d(buf));
+    mpf_sub(buf, im, view->cntr_im);
+    mpf_div(buf, buf, view->upp);
+    const double offs_im = fabs(mpf_get_d(buf));
+
+    return (offs_re <= 0.5 * settings->width)
+           && (offs_im <= 0.5 * settings->height);
+}
+
+/**
+ * Returns whether the reference orbit of `imgdata` can be reused for its
+ * current view, i.e., whether it has been computed with the current precision
+ * and its reference point still lies inside the view.
+ */
+static bool
+_imageData_is_orbit_reusable(ImageData *imgdata)
+{
+    if (!imgdata->is_orbit_valid) {
+        return false;
+    }
+
+    const ReferenceOrbit *const orbit = &imgdata->orbit;
+    return _imageData_is_in_view(imgdata, orbit->re, orbit->im);
+}
+
+/**
+ * Searches for the nucleus of the lowest-period component near the centre of
+ * the current view of `imgdata`. Returns whether a nucleus was found inside
+ * the view, in which case it is stored in `imgdata->nucleus`.
+ */
+static bool
+_imageData_find_nucleus(ImageData *imgdata)
+{
+    const Settings *const settings = imgdata->settings;
+    const View *const view = imgdata->view;
+    Nucleus *const nucleus = &imgdata->nucleus;
+
+    /* Search disk covers the whole view */
+    const double radius_px = 0.5 * hypot(settings->width, settings->height);
+    const mpf_ptr radius = imgdata->action_buf;
+    mpf_mul_ui(radius, view->upp, (unsigned long) ceil(radius_px));
+
+    if (!Nucleus_find(
+          nucleus, view->cntr_re, view->cntr_im, radius, settings->max_itrs
+        ))
+    {
+        return false;
+    }
+
+    return _imageData_is_in_view(imgdata, nucleus->re, nucleus->im);
 }
 
+/**
+ * Updates the reference orbit of `imgdata` and the data derived from it. The
+ * orbit is only computed anew if the current one cannot be reused. Its
+ * reference point is the nucleus of the lowest-period component in the view
+ * if there is one (its orbit never escapes, which avoids glitches and allows
+ * for skipping iterations along the full orbit) and the centre of the view
+ * otherwise.
+ */
 static void
-_imageData_clear_data(ImageData *imgdata)
+_imageData_update_orbit(ImageData *imgdata)
 {
+    static const double max_sqr
+      = ITERATION_CUTOFF_ABSOLUTE_VALUE * ITERATION_CUTOFF_ABSOLUTE_VALUE;
+
     const Settings *const settings = imgdata->settings;
-    const int num_tot = settings->width * settings->height;
-    for (int i = 0; i < num_tot; ++i) {
-        PixelData_clear(&imgdata->data[i]);
+    const View *const view = imgdata->view;
+    ReferenceOrbit *const orbit = &imgdata->orbit;
+
+    if (_imageData_is_orbit_reusable(imgdata)) {
+        cutil_log_debug("Reused reference orbit");
+    } else {
+        const Nucleus *const nucleus = &imgdata->nucleus;
+        const bool has_nucleus = _imageData_find_nucleus(imgdata);
+        const mpf_srcptr ref_re = has_nucleus ? nucleus->re : view->cntr_re;
+        const mpf_srcptr ref_im = has_nucleus ? nucleus->im : view->cntr_im;
+        if (has_nucleus) {
+            cutil_log_debug("Found nucleus of period %i", nucleus->period);
+        }
+
+        ReferenceOrbit_compute(
+          orbit, ref_re, ref_im, max_sqr, settings->max_itrs
+        );
+        imgdata->is_orbit_valid = true;
+        cutil_log_debug(
+          "Computed reference orbit: %i iterations", orbit->len - 1
+        );
+    }
+
+    const mpf_ptr buf = imgdata->action_buf;
+    mpf_sub(buf, view->cntr_re, orbit->re);
+    imgdata->view_d.ref_offs_re = mpf_get_d(buf);
+    imgdata->view_fe.ref_offs_re = FloatExp_from_mpf(buf);
+    mpf_sub(buf, view->cntr_im, orbit->im);
+    imgdata->view_d.ref_offs_im = mpf_get_d(buf);
+    imgdata->view_fe.ref_offs_im = FloatExp_from_mpf(buf);
+
+    /* Margin chunks are iterated with the same orbit when prefetched */
+    ChunkData *const chunks = &imgdata->chunks;
+    const ChunkParams *const params = &chunks->params;
+    const int num_spare = 2 * CHUNK_MARGIN + 1;
+    const int num_re = settings->width + num_spare * params->num_px_re;
+    const int num_im = settings->height + num_spare * params->num_px_im;
+
+    const double upp = imgdata->view_d.upp;
+    const double dc_max_re
+      = fabs(imgdata->view_d.ref_offs_re) + 0.5 * num_re * upp;
+    const double dc_max_im
+      = fabs(imgdata->view_d.ref_offs_im) + 0.5 * num_im * upp;
+    BlaTable_compute(&imgdata->bla, orbit, hypot(dc_max_re, dc_max_im));
+
+    /* Number of skipped iterations has to be determined anew for all chunks */
+    const int num_tot = chunks->num_re * chunks->num_im;
+    for (int idx = 0; idx < num_tot; ++idx) {
+        chunks->data[idx].skipped_itrs = -1;
+    }
+}
+
+/**
+ * Returns `x` rounded to a long double. GMP has no conversion of its own, so
+ * the leading two doubles of `x` are summed up.
+ */
+static long double
+_mpf_get_ld(mpf_srcptr x)
+{
+    const DoubleDouble dd = DoubleDouble_from_mpf(x);
+    return (long double) dd.hi + (long double) dd.lo;
+}
+
+/**
+ * Searches for higher-period components on a grid over the current view of
+ * `imgdata` if positions can be resolved by doubles, caches disks inside of
+ * them and activates the cached disks in the view. The search starts in the
+ * atom domain of each grid point.
+ */
+static void
+_imageData_update_interior(ImageData *imgdata)
+{
+    const Settings *const settings = imgdata->settings;
+    InteriorCache *const cache = &imgdata->interior;
+
+    const double upp = imgdata->view_d.upp;
+    const double width = settings->width * upp;
+    const double height = settings->height * upp;
+    const double re_min = imgdata->view_d.cntr_re - 0.5 * width;
+    const double im_min = imgdata->view_d.cntr_im - 0.5 * height;
+
+    if (imgdata->view_d.is_resolved) {
+        const int max_period = (settings->max_itrs < INTERIOR_MAX_PERIOD)
+                               ? settings->max_itrs
+                               : INTERIOR_MAX_PERIOD;
+        int num_added = 0;
+        for (int i = 0; i < INTERIOR_SEARCH_GRID; ++i) {
+            for (int j = 0; j < INTERIOR_SEARCH_GRID; ++j) {
+                const double re
+                  = re_min + (i + 0.5) * width / INTERIOR_SEARCH_GRID;
+                const double im
+                  = im_min + (j + 0.5) * height / INTERIOR_SEARCH_GRID;
+                const int period
+                  = Interior_find_atom_period(re, im, max_period);
+
+                /* Cardioid and bulb are tested analytically */
+                InteriorDisk disk;
+                if (period > 2
+                    && Interior_find_disk(
+                      &disk, re, im, period, settings->max_itrs
+                    )
+                    && disk.radius > INTERIOR_MIN_RADIUS_PX * upp
+                    && InteriorCache_add(cache, &disk))
+                {
+                    ++num_added;
+                }
+            }
+        }
+        if (num_added > 0) {
+            cutil_log_debug("Cached %i interior components", num_added);
+        }
+    }
+
+    InteriorCache_select(
+      cache, re_min, re_min + width, im_min, im_min + height
+    );
+}
+
+/**
+ * Determines whether the view of `imgdata` is symmetric with respect to the
+ * real axis, i.e., whether the conjugate of each pixel row is another pixel row
+ * (up to MIRROR_TOLERANCE_PX), and stores the sum of the indices of conjugate
+ * rows, or -1 if there are none in the image.
+ */
+static void
+_imageData_update_mirror(ImageData *imgdata)
+{
+    const int height = imgdata->settings->height;
+    const View *const view = imgdata->view;
+    const mpf_ptr buf = imgdata->action_buf;
+
+    /* Row idx_im lies at cntr_im + (idx_im - height / 2) * upp */
+    mpf_div(buf, view->cntr_im, view->upp);
+    mpf_mul_2exp(buf, buf, 1);
+    const double offs_cntr = mpf_get_d(buf);
+    const double offs_cntr_rounded = round(offs_cntr);
+    const int offs = 2 * (height / 2) - (int) offs_cntr_rounded;
+
+    imgdata->mirror_offs = -1;
+    if (fabs(offs_cntr) < 2.0 * height
+        && fabs(offs_cntr - offs_cntr_rounded) <= MIRROR_TOLERANCE_PX
+        && offs > 0 && offs < 2 * height - 2)
+    {
+        imgdata->mirror_offs = offs;
+    }
+}
+
+static void
+_imageData_update_tolerance(ImageData *imgdata)
+{
+    const mpf_srcptr upp = imgdata->view->upp;
+    const int tnum = imgdata->tnum;
+    for (int i = 0; i < tnum; ++i) {
+        PixelDataBuffer_set_tolerance(&imgdata->tbuf[i], upp);
+    }
+    imgdata->view_d.tol = PixelData_get_tolerance(mpf_get_d(upp));
+}
+
+/**
+ * Updates the cached double representation of the view of `imgdata` and
+ * chooses the kernel for the pixel iterations accordingly. Also adjusts the
+ * tolerance of the cycle detection, the known interior and the mirroring at the
+ * real axis to the view.
+ */
+static void
+_imageData_update_kernel(ImageData *imgdata)
+{
+    const View *const view = imgdata->view;
+    _imageData_update_tolerance(imgdata);
+
+    imgdata->view_d.cntr_re = mpf_get_d(view->cntr_re);
+    imgdata->view_d.cntr_im = mpf_get_d(view->cntr_im);
+    imgdata->view_d.upp = mpf_get_d(view->upp);
+    imgdata->view_fe.upp = FloatExp_from_mpf(view->upp);
+    imgdata->view_d.is_resolved
+      = (_imageData_get_position_bits(imgdata) <= DBL_MANT_DIG);
+    imgdata->view_d.series_tol = _imageData_get_series_tolerance(imgdata);
+
+    const char *reason = NULL;
+    const enum PixelKernel kernel = _imageData_choose_kernel(imgdata, &reason);
+    if (kernel != imgdata->kernel) {
+        imgdata->kernel = kernel;
+        cutil_log_debug(
+          "Switched to %s kernel (%s: %i bits, %i iterations)",
+          _imageData_get_kernel_name(kernel), reason,
+          _imageData_get_required_bits(imgdata), imgdata->settings->max_itrs
+        );
+    }
+
+    const enum PixelKernel full_kernel = _imageData_choose_full_kernel(imgdata);
+    if (full_kernel != imgdata->full_kernel) {
+        imgdata->full_kernel = full_kernel;
+        cutil_log_debug(
+          "Switched to %s kernel for full precision",
+          _imageData_get_kernel_name(full_kernel)
+        );
+    }
+
+    if (kernel == PIXEL_KERNEL_LDOUBLE || full_kernel == PIXEL_KERNEL_LDOUBLE) {
+        imgdata->view_ld.cntr_re = _mpf_get_ld(view->cntr_re);
+        imgdata->view_ld.cntr_im = _mpf_get_ld(view->cntr_im);
+        imgdata->view_ld.upp = _mpf_get_ld(view->upp);
+    }
+
+    if (kernel == PIXEL_KERNEL_DDOUBLE || full_kernel == PIXEL_KERNEL_DDOUBLE) {
+        imgdata->view_dd.cntr_re = DoubleDouble_from_mpf(view->cntr_re);
+        imgdata->view_dd.cntr_im = DoubleDouble_from_mpf(view->cntr_im);
+        imgdata->view_dd.upp = DoubleDouble_from_mpf(view->upp);
+    }
+
+    if (kernel == PIXEL_KERNEL_QDOUBLE || full_kernel == PIXEL_KERNEL_QDOUBLE) {
+        imgdata->view_qd.cntr_re = QuadDouble_from_mpf(view->cntr_re);
+        imgdata->view_qd.cntr_im = QuadDouble_from_mpf(view->cntr_im);
+        imgdata->view_qd.upp = QuadDouble_from_mpf(view->upp);
+    }
+
+    if (_imageData_is_kernel_perturbative(kernel)) {
+        _imageData_update_orbit(imgdata);
+    }
+
+    _imageData_update_interior(imgdata);
+    _imageData_update_mirror(imgdata);
+}
+
+static void
+_imageData_clear_mpf(ImageData *imgdata)
+{
+    mpf_clear(imgdata->action_buf);
+}
+
+static void
+_imageData_clear_view(ImageData *imgdata)
+{
+    View_free(imgdata->view);
+}
+
+static void
+_imageData_clear_data(ImageData *imgdata)
+{
+    const int num_tot = _imageData_get_num_px(imgdata);
+    for (int i = 0; i < num_tot; ++i) {
+        PixelData_clear(&imgdata->data[i]);
+    }
+    free(imgdata->data);
+    free(imgdata->framebuf);
+    Settings_free(imgdata->settings);
+    free(imgdata->view_fname);
+}
+
+static void
+_imageData_clear_tbuf(ImageData *imgdata)
+{
+    const int tnum = imgdata->tnum;
+    for (int i = 0; i < tnum; ++i) {
+        PixelDataBuffer_clear(&imgdata->tbuf[i]);
+    }
+    free(imgdata->tbuf);
+}
+
+static void
+_imageData_clear_orbit(ImageData *imgdata)
+{
+    ReferenceOrbit_clear(&imgdata->orbit);
+    Nucleus_clear(&imgdata->nucleus);
+    BlaTable_clear(&imgdata->bla);
+
+    const int tnum = imgdata->tnum;
+    for (int i = 0; i < tnum; ++i) {
+        ReferenceOrbit_clear(&imgdata->torbit[i]);
+    }
+    free(imgdata->torbit);
+}
+
+static void
+_imageData_clear_chunks(ImageData *imgdata)
+{
+    ChunkData *const chunks = &imgdata->chunks;
+    ChunkData_clear(chunks);
+}
+
+static void
+_imageData_clear(ImageData *imgdata)
+{
+    _imageData_clear_mpf(imgdata);
+    _imageData_clear_view(imgdata);
+    _imageData_clear_data(imgdata);
+    _imageData_clear_tbuf(imgdata);
+    _imageData_clear_orbit(imgdata);
+    _imageData_clear_chunks(imgdata);
+}
+
+static void
+_imageData_set_prec_mpf(ImageData *imgdata)
+{
+    const mp_bitcnt_t prec = imgdata->prec;
+    mpf_set_prec(imgdata->action_buf, prec);
+}
+
+static void
+_imageData_set_prec_view(ImageData *imgdata)
+{
+    const mp_bitcnt_t prec = imgdata->prec;
+    View_set_precision(imgdata->view, prec);
+}
+
+static void
+_imageData_set_prec_data(ImageData *imgdata)
+{
+    const int num_tot = _imageData_get_num_px(imgdata);
+    const mp_bitcnt_t prec = imgdata->prec;
+    for (int i = 0; i < num_tot; ++i) {
+        PixelData_set_prec(&imgdata->data[i], prec);
+    }
+}
+
+static void
+_imageData_set_prec_tbuf(ImageData *imgdata)
+{
+    const mp_bitcnt_t prec = imgdata->prec;
+    const int tnum = imgdata->tnum;
+    for (int i = 0; i < tnum; ++i) {
+        PixelDataBuffer *const buf = &imgdata->tbuf[i];
+        PixelDataBuffer_set_prec(buf, prec);
+    }
+}
+
+static void
+_imageData_set_prec_orbit(ImageData *imgdata)
+{
+    const mp_bitcnt_t prec = imgdata->prec;
+    ReferenceOrbit_set_prec(&imgdata->orbit, prec);
+    imgdata->is_orbit_valid = false;
+    Nucleus_set_prec(&imgdata->nucleus, prec);
+
+    const int tnum = imgdata->tnum;
+    for (int i = 0; i < tnum; ++i) {
+        ReferenceOrbit_set_prec(&imgdata->torbit[i], prec);
+    }
+}
+
+static void
+_imageData_set_prec(ImageData *imgdata, mp_bitcnt_t prec)
+{
+    imgdata->prec = prec;
+    _imageData_set_prec_mpf(imgdata);
+    _imageData_set_prec_view(imgdata);
+    _imageData_set_prec_data(imgdata);
+    _imageData_set_prec_tbuf(imgdata);
+    _imageData_set_prec_orbit(imgdata);
+}
+
+static ImageData *
+_imageData_alloc(const Settings *settings)
+{
+    ImageData *const imgdata = malloc(sizeof *imgdata);
+
+    imgdata->settings = Settings_duplicate(settings);
+    imgdata->prec = INITIAL_PRECISION;
+    mpf_set_default_prec(INITIAL_PRECISION);
+
+    _imageData_init_mpf(imgdata);
+    _imageData_init_view(imgdata);
+    _imageData_init_data(imgdata);
+    _imageData_init_tbuf(imgdata);
+    _imageData_init_orbit(imgdata);
+    _imageData_init_interior(imgdata);
+    _imageData_init_chunks(imgdata);
+    _imageData_init_view_fname(imgdata);
+
+    _imageData_init_kernel(imgdata);
+    _imageData_init_fill_mode(imgdata);
+    const mp_bitcnt_t prec = _imageData_get_new_prec(imgdata);
+    if (prec != imgdata->prec) {
+        _imageData_set_prec(imgdata, prec);
+    }
+    _imageData_update_kernel(imgdata);
+
+    imgdata->state = DATA_STATE_WORKING;
+    imgdata->step = PROGRESSIVE_MAX_STEP;
+    imgdata->num_frames = 0;
+    imgdata->target_ticks = 0;
+
+    return imgdata;
+}
+
+/**
+ * Sets the mpf fields of `px` to the position of the pixel (`idx_re`,
+ * `idx_im`) in the current view of `imgdata`.
+ */
+static void
+_imageData_set_pixel_pos(
+  const ImageData *imgdata, PixelData *px, int idx_re, int idx_im
+)
+{
+    const Settings *const settings = imgdata->settings;
+    const int idx_cntr_re = settings->width / 2;
+    const int idx_cntr_im = settings->height / 2;
+
+    const View *const view = imgdata->view;
+    const mpf_srcptr cntr_re = view->cntr_re;
+    const mpf_srcptr cntr_im = view->cntr_im;
+    const mpf_srcptr upp = view->upp;
+
+    mpf_set_d(px->re, (1.0 * (idx_re - idx_cntr_re)));
+    mpf_mul(px->re, px->re, upp);
+    mpf_add(px->re, px->re, cntr_re);
+
+    mpf_set_d(px->im, (1.0 * (idx_im - idx_cntr_im)));
+    mpf_mul(px->im, px->im, upp);
+    mpf_add(px->im, px->im, cntr_im);
+}
+
+static void
+_imageData_iterate_pixel_mpf(
+  const ImageData *imgdata, PixelData *px, int idx_re, int idx_im
+)
+{
+    const Settings *const settings = imgdata->settings;
+    _imageData_set_pixel_pos(imgdata, px, idx_re, idx_im);
+
+    const int tid = omp_get_thread_num();
+    PixelDataBuffer *const buf = &imgdata->tbuf[tid];
+    PixelData_iterate(px, buf, settings->max_itrs);
+}
+
+static void
+_imageData_iterate_pixel_fixed(
+  const ImageData *imgdata, PixelData *px, int idx_re, int idx_im
+)
+{
+    const Settings *const settings = imgdata->settings;
+    _imageData_set_pixel_pos(imgdata, px, idx_re, idx_im);
+
+    const int tid = omp_get_thread_num();
+    PixelDataBuffer *const buf = &imgdata->tbuf[tid];
+    if (!PixelData_iterate_fixed(px, buf, settings->max_itrs)) {
+        PixelData_iterate(px, buf, settings->max_itrs);
+    }
+}
+
+static void
+_imageData_iterate_pixel_double(
+  const ImageData *imgdata, PixelData *px, int idx_re, int idx_im
+)
+{
+    static const double max_sqr
+      = ITERATION_CUTOFF_ABSOLUTE_VALUE * ITERATION_CUTOFF_ABSOLUTE_VALUE;
+
+    const Settings *const settings = imgdata->settings;
+    const int idx_cntr_re = settings->width / 2;
+    const int idx_cntr_im = settings->height / 2;
+
+    const double upp = imgdata->view_d.upp;
+    const double re = imgdata->view_d.cntr_re + (idx_re - idx_cntr_re) * upp;
+    const double im = imgdata->view_d.cntr_im + (idx_im - idx_cntr_im) * upp;
+    PixelData_iterate_double(
+      px, re, im, max_sqr, imgdata->view_d.tol, settings->max_itrs
+    );
+}
+
+static void
+_imageData_iterate_pixel_ldouble(
+  const ImageData *imgdata, PixelData *px, int idx_re, int idx_im
+)
+{
+    static const double max_sqr
+      = ITERATION_CUTOFF_ABSOLUTE_VALUE * ITERATION_CUTOFF_ABSOLUTE_VALUE;
+
+    const Settings *const settings = imgdata->settings;
+    const int idx_cntr_re = settings->width / 2;
+    const int idx_cntr_im = settings->height / 2;
+
+    const long double upp = imgdata->view_ld.upp;
+    const long double re
+      = imgdata->view_ld.cntr_re + (idx_re - idx_cntr_re) * upp;
+    const long double im
+      = imgdata->view_ld.cntr_im + (idx_im - idx_cntr_im) * upp;
+    PixelData_iterate_ldouble(
+      px, re, im, max_sqr, imgdata->view_d.tol, settings->max_itrs
+    );
+}
+
+static void
+_imageData_iterate_pixel_ddouble(
+  const ImageData *imgdata, PixelData *px, int idx_re, int idx_im
+)
+{
+    static const double max_sqr
+      = ITERATION_CUTOFF_ABSOLUTE_VALUE * ITERATION_CUTOFF_ABSOLUTE_VALUE;
+
+    const Settings *const settings = imgdata->settings;
+    const int idx_cntr_re = settings->width / 2;
+    const int idx_cntr_im = settings->height / 2;
+
+    const DoubleDouble upp = imgdata->view_dd.upp;
+    const DoubleDouble re = DoubleDouble_add(
+      imgdata->view_dd.cntr_re, DoubleDouble_mul_d(upp, idx_re - idx_cntr_re)
+    );
+    const DoubleDouble im = DoubleDouble_add(
+      imgdata->view_dd.cntr_im, DoubleDouble_mul_d(upp, idx_im - idx_cntr_im)
+    );
+    PixelData_iterate_ddouble(
+      px, re, im, max_sqr, imgdata->view_d.tol, settings->max_itrs
+    );
+}
+
+static void
+_imageData_iterate_pixel_qdouble(
+  const ImageData *imgdata, PixelData *px, int idx_re, int idx_im
+)
+{
+    static const double max_sqr
+      = ITERATION_CUTOFF_ABSOLUTE_VALUE * ITERATION_CUTOFF_ABSOLUTE_VALUE;
+
+    const Settings *const settings = imgdata->settings;
+    const int idx_cntr_re = settings->width / 2;
+    const int idx_cntr_im = settings->height / 2;
+
+    const QuadDouble upp = imgdata->view_qd.upp;
+    const QuadDouble re = QuadDouble_add(
+      imgdata->view_qd.cntr_re, QuadDouble_mul_d(upp, idx_re - idx_cntr_re)
+    );
+    const QuadDouble im = QuadDouble_add(
+      imgdata->view_qd.cntr_im, QuadDouble_mul_d(upp, idx_im - idx_cntr_im)
+    );
+    PixelData_iterate_qdouble(
+      px, re, im, max_sqr, imgdata->view_d.tol, settings->max_itrs
+    );
+}
+
+/**
+ * Iterates `px` in full precision, i.e., without perturbation, by the cheapest
+ * kernel that resolves the current view.
+ */
+static void
+_imageData_iterate_pixel_full(
+  const ImageData *imgdata, PixelData *px, int idx_re, int idx_im
+)
+{
+    switch (imgdata->full_kernel) {
+    case PIXEL_KERNEL_DOUBLE:
+        _imageData_iterate_pixel_double(imgdata, px, idx_re, idx_im);
+        break;
+    case PIXEL_KERNEL_LDOUBLE:
+        _imageData_iterate_pixel_ldouble(imgdata, px, idx_re, idx_im);
+        break;
+    case PIXEL_KERNEL_DDOUBLE:
+        _imageData_iterate_pixel_ddouble(imgdata, px, idx_re, idx_im);
+        break;
+    case PIXEL_KERNEL_QDOUBLE:
+        _imageData_iterate_pixel_qdouble(imgdata, px, idx_re, idx_im);
+        break;
+    case PIXEL_KERNEL_FIXED:
+        _imageData_iterate_pixel_fixed(imgdata, px, idx_re, idx_im);
+        break;
+    default:
+        _imageData_iterate_pixel_mpf(imgdata, px, idx_re, idx_im);
+        break;
+    }
+}
+
+static bool
+_imageData_iterate_pixel_perturbed(
+  const ImageData *imgdata, PixelData *px, int idx_re, int idx_im, int skip
+)
+{
+    static const double max_sqr
+      = ITERATION_CUTOFF_ABSOLUTE_VALUE * ITERATION_CUTOFF_ABSOLUTE_VALUE;
+
+    const Settings *const settings = imgdata->settings;
+    const int idx_cntr_re = settings->width / 2;
+    const int idx_cntr_im = settings->height / 2;
+
+    const double upp = imgdata->view_d.upp;
+    const double dc_re
+      = imgdata->view_d.ref_offs_re + (idx_re - idx_cntr_re) * upp;
+    const double dc_im
+      = imgdata->view_d.ref_offs_im + (idx_im - idx_cntr_im) * upp;
+
+    const ReferenceOrbit *const orbit = &imgdata->orbit;
+    const BlaTable *const bla = imgdata->use_bla ? &imgdata->bla : NULL;
+    return PixelData_iterate_perturbed(
+      px, orbit, bla, dc_re, dc_im, skip, max_sqr, imgdata->view_d.tol,
+      settings->max_itrs
+    );
+}
+
+static bool
+_imageData_iterate_pixel_floatexp(
+  const ImageData *imgdata, PixelData *px, int idx_re, int idx_im
+)
+{
+    static const double max_sqr
+      = ITERATION_CUTOFF_ABSOLUTE_VALUE * ITERATION_CUTOFF_ABSOLUTE_VALUE;
+
+    const Settings *const settings = imgdata->settings;
+    const int idx_cntr_re = settings->width / 2;
+    const int idx_cntr_im = settings->height / 2;
+
+    const FloatExp upp = imgdata->view_fe.upp;
+    const FloatExp dc_re = FloatExp_add(
+      imgdata->view_fe.ref_offs_re, FloatExp_mul_d(upp, idx_re - idx_cntr_re)
+    );
+    const FloatExp dc_im = FloatExp_add(
+      imgdata->view_fe.ref_offs_im, FloatExp_mul_d(upp, idx_im - idx_cntr_im)
+    );
+
+    const ReferenceOrbit *const orbit = &imgdata->orbit;
+    const BlaTable *const bla = imgdata->use_bla ? &imgdata->bla : NULL;
+    return PixelData_iterate_perturbed_floatexp(
+      px, orbit, bla, dc_re, dc_im, max_sqr, imgdata->view_d.tol,
+      settings->max_itrs
+    );
+}
+
+/**
+ * Iterates `px` at (`idx_re`, `idx_im`) by perturbation of the secondary
+ * reference orbit `orbit` of the pixel (`idx_ref_re`, `idx_ref_im`).
+ */
+static bool
+_imageData_iterate_pixel_secondary(
+  const ImageData *imgdata, PixelData *px, int idx_re, int idx_im,
+  const ReferenceOrbit *orbit, int idx_ref_re, int idx_ref_im
+)
+{
+    static const double max_sqr
+      = ITERATION_CUTOFF_ABSOLUTE_VALUE * ITERATION_CUTOFF_ABSOLUTE_VALUE;
+
+    const Settings *const settings = imgdata->settings;
+
+    if (imgdata->kernel == PIXEL_KERNEL_FLOATEXP) {
+        const FloatExp upp = imgdata->view_fe.upp;
+        const FloatExp dc_re = FloatExp_mul_d(upp, idx_re - idx_ref_re);
+        const FloatExp dc_im = FloatExp_mul_d(upp, idx_im - idx_ref_im);
+        return PixelData_iterate_perturbed_floatexp(
+          px, orbit, NULL, dc_re, dc_im, max_sqr, imgdata->view_d.tol,
+          settings->max_itrs
+        );
+    }
+
+    const double upp = imgdata->view_d.upp;
+    const double dc_re = (idx_re - idx_ref_re) * upp;
+    const double dc_im = (idx_im - idx_ref_im) * upp;
+    return PixelData_iterate_perturbed(
+      px, orbit, NULL, dc_re, dc_im, 0, max_sqr, imgdata->view_d.tol,
+      settings->max_itrs
+    );
+}
+
+/**
+ * Returns the number of iterations that can be skipped by the series
+ * approximation for all pixels of `chunk`. The error bound is checked at the
+ * corners of `chunk`.
+ */
+static int
+_imageData_get_chunk_skip(const ImageData *imgdata, const PixelChunk *chunk)
+{
+    static const double max_sqr
+      = ITERATION_CUTOFF_ABSOLUTE_VALUE * ITERATION_CUTOFF_ABSOLUTE_VALUE;
+
+    const ChunkData *const chunks = &imgdata->chunks;
+    const ChunkParams *const params = &chunks->params;
+    const Settings *const settings = imgdata->settings;
+    const int idx_cntr_re = settings->width / 2;
+    const int idx_cntr_im = settings->height / 2;
+
+    const int idx_re_min = PixelChunk_get_idx_re(chunk, chunks, 0);
+    const int idx_im_min = PixelChunk_get_idx_im(chunk, chunks, 0);
+    const int idx_re_max = idx_re_min + params->num_px_re - 1;
+    const int idx_im_max = idx_im_min + params->num_px_im - 1;
+
+    const double upp = imgdata->view_d.upp;
+    const double offs_re = imgdata->view_d.ref_offs_re;
+    const double offs_im = imgdata->view_d.ref_offs_im;
+    const double dc_re_min = offs_re + (idx_re_min - idx_cntr_re) * upp;
+    const double dc_re_max = offs_re + (idx_re_max - idx_cntr_re) * upp;
+    const double dc_im_min = offs_im + (idx_im_min - idx_cntr_im) * upp;
+    const double dc_im_max = offs_im + (idx_im_max - idx_cntr_im) * upp;
+
+    const double dc_re[] = {dc_re_min, dc_re_max, dc_re_min, dc_re_max};
+    const double dc_im[] = {dc_im_min, dc_im_min, dc_im_max, dc_im_max};
+    const int num = (sizeof dc_re) / (sizeof *dc_re);
+
+    const ReferenceOrbit *const orbit = &imgdata->orbit;
+    return ReferenceOrbit_get_skip(
+      orbit, dc_re, dc_im, num, max_sqr, imgdata->view_d.series_tol
+    );
+}
+
+/**
+ * Returns whether the pixel at (`idx_re`, `idx_im`) is known to be interior,
+ * in which case its result is written to `px` without iterating it.
+ */
+static bool
+_imageData_classify_pixel(
+  const ImageData *imgdata, PixelData *px, int idx_re, int idx_im
+)
+{
+    const Settings *const settings = imgdata->settings;
+    const int idx_cntr_re = settings->width / 2;
+    const int idx_cntr_im = settings->height / 2;
+
+    const double upp = imgdata->view_d.upp;
+    const double re = imgdata->view_d.cntr_re + (idx_re - idx_cntr_re) * upp;
+    const double im = imgdata->view_d.cntr_im + (idx_im - idx_cntr_im) * upp;
+    if (!InteriorCache_contains(&imgdata->interior, re, im)) {
+        return false;
+    }
+
+    px->itrs = 0.0F;
+    px->flags = PIXEL_FLAG_NONE;
+    return true;
+}
+
+static void
+_imageData_update_chunk_pixels(
+  const ImageData *imgdata, PixelChunk *chunk, int idx_px_re, int idx_px_im
+)
+{
+    const ChunkData *const chunks = &imgdata->chunks;
+    const ChunkParams *const params = &chunks->params;
+
+    const int stride = params->stride;
+    const int idx_px = idx_px_re * stride + idx_px_im;
+    PixelData *const px = &chunk->data[idx_px];
+
+    /* Glitched pixels are corrected separately */
+    if (px->state == PIXEL_STATE_VALID || px->state == PIXEL_STATE_GLITCHED) {
+        return;
+    }
+
+    const int idx_re = PixelChunk_get_idx_re(chunk, chunks, idx_px_re);
+    const int idx_im = PixelChunk_get_idx_im(chunk, chunks, idx_px_im);
+
+    if (_imageData_classify_pixel(imgdata, px, idx_re, idx_im)) {
+        px->state = PIXEL_STATE_VALID;
+        return;
+    }
+
+    switch (imgdata->kernel) {
+    case PIXEL_KERNEL_PERTURBATION:
+        if (_imageData_iterate_pixel_perturbed(
+              imgdata, px, idx_re, idx_im, chunk->skipped_itrs
+            ))
+        {
+            break;
+        }
+        /* Pixel outlived reference orbit, so iterate it in full precision */
+        _imageData_iterate_pixel_full(imgdata, px, idx_re, idx_im);
+        break;
+    case PIXEL_KERNEL_FLOATEXP:
+        if (_imageData_iterate_pixel_floatexp(imgdata, px, idx_re, idx_im)) {
+            break;
+        }
+        /* Pixel outlived reference orbit, so iterate it in full precision */
+        _imageData_iterate_pixel_full(imgdata, px, idx_re, idx_im);
+        break;
+    case PIXEL_KERNEL_DOUBLE:
+        _imageData_iterate_pixel_double(imgdata, px, idx_re, idx_im);
+        break;
+    case PIXEL_KERNEL_LDOUBLE:
+        _imageData_iterate_pixel_ldouble(imgdata, px, idx_re, idx_im);
+        break;
+    case PIXEL_KERNEL_DDOUBLE:
+        _imageData_iterate_pixel_ddouble(imgdata, px, idx_re, idx_im);
+        break;
+    case PIXEL_KERNEL_QDOUBLE:
+        _imageData_iterate_pixel_qdouble(imgdata, px, idx_re, idx_im);
+        break;
+    case PIXEL_KERNEL_FIXED:
+        _imageData_iterate_pixel_fixed(imgdata, px, idx_re, idx_im);
+        break;
+    case PIXEL_KERNEL_MPF:
+    default:
+        _imageData_iterate_pixel_mpf(imgdata, px, idx_re, idx_im);
+        break;
+    }
+
+    if (px->state != PIXEL_STATE_GLITCHED) {
+        px->state = PIXEL_STATE_VALID;
+    }
+}
+
+/**
+ * Finds the pixel of `chunk` to compute a secondary reference orbit at, i.e.,
+ * the glitched pixel closest to the centroid of all glitched pixels. Returns
+ * false if there are no glitched pixels.
+ */
+static bool
+_imageData_find_secondary_reference(
+  const ImageData *imgdata, const PixelChunk *chunk, int *p_idx_px_re,
+  int *p_idx_px_im
+)
+{
+    const ChunkData *const chunks = &imgdata->chunks;
+    const ChunkParams *const params = &chunks->params;
+    const int stride = params->stride;
+    const int num_px_re = params->num_px_re;
+    const int num_px_im = params->num_px_im;
+
+    int num_glitched = 0;
+    double sum_re = 0.0;
+    double sum_im = 0.0;
+    for (int idx_px_re = 0; idx_px_re < num_px_re; ++idx_px_re) {
+        for (int idx_px_im = 0; idx_px_im < num_px_im; ++idx_px_im) {
+            const int idx_px = idx_px_re * stride + idx_px_im;
+            const PixelData *const px = &chunk->data[idx_px];
+            if (px->state == PIXEL_STATE_GLITCHED) {
+                ++num_glitched;
+                sum_re += idx_px_re;
+                sum_im += idx_px_im;
+            }
+        }
+    }
+
+    if (num_glitched == 0) {
+        return false;
+    }
+
+    const double cntr_re = sum_re / num_glitched;
+    const double cntr_im = sum_im / num_glitched;
+    double min_dist_sqr = HUGE_VAL;
+    for (int idx_px_re = 0; idx_px_re < num_px_re; ++idx_px_re) {
+        for (int idx_px_im = 0; idx_px_im < num_px_im; ++idx_px_im) {
+            const int idx_px = idx_px_re * stride + idx_px_im;
+            const PixelData *const px = &chunk->data[idx_px];
+            if (px->state != PIXEL_STATE_GLITCHED) {
+                continue;
+            }
+            const double diff_re = idx_px_re - cntr_re;
+            const double diff_im = idx_px_im - cntr_im;
+            const double dist_sqr = diff_re * diff_re + diff_im * diff_im;
+            if (dist_sqr < min_dist_sqr) {
+                min_dist_sqr = dist_sqr;
+                *p_idx_px_re = idx_px_re;
+                *p_idx_px_im = idx_px_im;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Iterates all glitched pixels of `chunk` again by perturbation of the
+ * secondary reference orbit `orbit` of the pixel (`idx_ref_re`, `idx_ref_im`)
+ * or in full precision if `orbit` is NULL.
+ */
+static void
+_imageData_iterate_glitched_pixels(
+  const ImageData *imgdata, PixelChunk *chunk, const ReferenceOrbit *orbit,
+  int idx_ref_re, int idx_ref_im
+)
+{
+    const ChunkData *const chunks = &imgdata->chunks;
+    const ChunkParams *const params = &chunks->params;
+    const int stride = params->stride;
+    const int num_px_re = params->num_px_re;
+    const int num_px_im = params->num_px_im;
+
+    for (int idx_px_re = 0; idx_px_re < num_px_re; ++idx_px_re) {
+        for (int idx_px_im = 0; idx_px_im < num_px_im; ++idx_px_im) {
+            PixelData *const px = &chunk->data[idx_px_re * stride + idx_px_im];
+            if (px->state != PIXEL_STATE_GLITCHED) {
+                continue;
+            }
+
+            const int idx_re = PixelChunk_get_idx_re(chunk, chunks, idx_px_re);
+            const int idx_im = PixelChunk_get_idx_im(chunk, chunks, idx_px_im);
+
+            px->state = PIXEL_STATE_INVALID;
+            if (orbit == NULL
+                || !_imageData_iterate_pixel_secondary(
+                  imgdata, px, idx_re, idx_im, orbit, idx_ref_re, idx_ref_im
+                ))
+            {
+                _imageData_iterate_pixel_full(imgdata, px, idx_re, idx_im);
+            }
+
+            if (px->state != PIXEL_STATE_GLITCHED) {
+                px->state = PIXEL_STATE_VALID;
+            }
+        }
+    }
+}
+
+/**
+ * Corrects the glitched pixels of `chunk` by iterating them again against
+ * secondary reference orbits chosen inside the glitched region. Each
+ * secondary reference point is a glitched pixel itself, which is thus
+ * corrected in any case. Pixels that are still glitched after
+ * GLITCH_MAX_SECONDARY_REFERENCES secondary reference orbits are iterated in
+ * full precision. Returns false if the time ran out before all glitches were
+ * corrected.
+ */
+static bool
+_imageData_correct_glitches(const ImageData *imgdata, PixelChunk *chunk)
+{
+    static const double max_sqr
+      = ITERATION_CUTOFF_ABSOLUTE_VALUE * ITERATION_CUTOFF_ABSOLUTE_VALUE;
+
+    const Settings *const settings = imgdata->settings;
+    const ChunkData *const chunks = &imgdata->chunks;
+    const ChunkParams *const params = &chunks->params;
+
+    const bool is_perturbed
+      = _imageData_is_kernel_perturbative(imgdata->kernel);
+    const int tid = omp_get_thread_num();
+    ReferenceOrbit *const orbit = &imgdata->torbit[tid];
+
+    for (int num_refs = 0; num_refs <= GLITCH_MAX_SECONDARY_REFERENCES;
+         ++num_refs)
+    {
+        int idx_px_re = 0;
+        int idx_px_im = 0;
+        if (!_imageData_find_secondary_reference(
+              imgdata, chunk, &idx_px_re, &idx_px_im
+            ))
+        {
+            return true;
+        }
+
+        if (!is_perturbed || num_refs == GLITCH_MAX_SECONDARY_REFERENCES) {
+            _imageData_iterate_glitched_pixels(imgdata, chunk, NULL, 0, 0);
+            return true;
+        }
+
+        const int idx_ref_re = PixelChunk_get_idx_re(chunk, chunks, idx_px_re);
+        const int idx_ref_im = PixelChunk_get_idx_im(chunk, chunks, idx_px_im);
+
+        const int idx_px = idx_px_re * params->stride + idx_px_im;
+        PixelData *const px_ref = &chunk->data[idx_px];
+        _imageData_set_pixel_pos(imgdata, px_ref, idx_ref_re, idx_ref_im);
+        ReferenceOrbit_compute(
+          orbit, px_ref->re, px_ref->im, max_sqr, settings->max_itrs
+        );
+        _imageData_iterate_glitched_pixels(
+          imgdata, chunk, orbit, idx_ref_re, idx_ref_im
+        );
+
+        if (SDL_GetTicks64() > imgdata->target_ticks) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Updates the `num` pixels `spacing` apart from (`idx_px_re`, `idx_px_im`) on
+ * in `chunk` along the imaginary direction, or the real direction if
+ * `is_column` is set, with the vectorized double-precision kernel. Pixels that
+ * are not valid yet are processed in runs of equal distance, i.e., consecutive
+ * pixels or, e.g., every second pixel between the samples of progressive
+ * passes, which keeps the vector lanes filled.
+ */
+static void
+_imageData_update_chunk_segments(
+  const ImageData *imgdata, PixelChunk *chunk, int idx_px_re, int idx_px_im,
+  int num, bool is_column, int spacing
+)
+{
+    static const double max_sqr
+      = ITERATION_CUTOFF_ABSOLUTE_VALUE * ITERATION_CUTOFF_ABSOLUTE_VALUE;
+
+    const ChunkData *const chunks = &imgdata->chunks;
+    const ChunkParams *const params = &chunks->params;
+    const Settings *const settings = imgdata->settings;
+
+    const int stride = params->stride;
+    const int step = (is_column ? stride : 1) * spacing;
+    PixelData *const line = &chunk->data[idx_px_re * stride + idx_px_im];
+
+    const int idx_cntr_re = settings->width / 2;
+    const int idx_cntr_im = settings->height / 2;
+    const int idx_re_0 = PixelChunk_get_idx_re(chunk, chunks, idx_px_re);
+    const int idx_im_0 = PixelChunk_get_idx_im(chunk, chunks, idx_px_im);
+    const int step_re = is_column ? spacing : 0;
+    const int step_im = is_column ? 0 : spacing;
+
+    for (int idx = 0; idx < num; ++idx) {
+        PixelData *const px = &line[idx * step];
+        const int idx_re = idx_re_0 + idx * step_re;
+        const int idx_im = idx_im_0 + idx * step_im;
+        if (px->state != PIXEL_STATE_VALID
+            && _imageData_classify_pixel(imgdata, px, idx_re, idx_im))
+        {
+            px->state = PIXEL_STATE_VALID;
+        }
+    }
+
+    const double upp = imgdata->view_d.upp;
+    const double tol = imgdata->view_d.tol;
+    const uint16_t max_itrs = settings->max_itrs;
+
+    for (int idx = 0; idx < num; ++idx) {
+        if (line[idx * step].state == PIXEL_STATE_VALID) {
+            continue;
+        }
+
+        /* Runs continue at the distance of the next pixel that is not valid */
+        int dist = 1;
+        while (idx + dist < num
+               && line[(idx + dist) * step].state == PIXEL_STATE_VALID)
+        {
+            ++dist;
+        }
+        if (idx + dist >= num) {
+            dist = 1;
+        }
+        int len = 1;
+        while (idx + len * dist < num
+               && line[(idx + len * dist) * step].state != PIXEL_STATE_VALID)
+        {
+            ++len;
+        }
+
+        const int idx_re = idx_re_0 + idx * step_re;
+        const int idx_im = idx_im_0 + idx * step_im;
+        const double re
+          = imgdata->view_d.cntr_re + (idx_re - idx_cntr_re) * upp;
+        const double im
+          = imgdata->view_d.cntr_im + (idx_im - idx_cntr_im) * upp;
+        PixelData_iterate_double_line(
+          &line[idx * step], dist * step, len, re, im, dist * step_re * upp,
+          dist * step_im * upp, max_sqr, tol, max_itrs
+        );
+    }
+}
+
+/**
+ * Updates all pixels of `chunk` in the rectangle of `num_re` times `num_im`
+ * pixels from (`idx_px_re`, `idx_px_im`) on. Returns false if the time ran out
+ * before all of them were updated.
+ */
+static bool
+_imageData_update_chunk_rect(
+  const ImageData *imgdata, PixelChunk *chunk, int idx_px_re, int idx_px_im,
+  int num_re, int num_im
+)
+{
+    if (imgdata->kernel == PIXEL_KERNEL_DOUBLE) {
+        /* Single columns are vectorized along the real direction */
+        if (num_im == 1) {
+            _imageData_update_chunk_segments(
+              imgdata, chunk, idx_px_re, idx_px_im, num_re, true, 1
+            );
+            return (SDL_GetTicks64() <= imgdata->target_ticks);
+        }
+        for (int idx = 0; idx < num_re; ++idx) {
+            _imageData_update_chunk_segments(
+              imgdata, chunk, idx_px_re + idx, idx_px_im, num_im, false, 1
+            );
+            if (SDL_GetTicks64() > imgdata->target_ticks) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const int idx_px_re_end = idx_px_re + num_re;
+    const int idx_px_im_end = idx_px_im + num_im;
+    for (int idx_re = idx_px_re; idx_re < idx_px_re_end; ++idx_re) {
+        for (int idx_im = idx_px_im; idx_im < idx_px_im_end; ++idx_im) {
+            _imageData_update_chunk_pixels(imgdata, chunk, idx_re, idx_im);
+            if (SDL_GetTicks64() > imgdata->target_ticks) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Returns whether all pixels on the border of the rectangle of `num_re` times
+ * `num_im` pixels from (`idx_px_re`, `idx_px_im`) on in `chunk` are valid and
+ * have the same number of iterations, which is written to `p_itrs`.
+ */
+static bool
+_imageData_is_border_uniform(
+  const ImageData *imgdata, const PixelChunk *chunk, int idx_px_re,
+  int idx_px_im, int num_re, int num_im, float *p_itrs
+)
+{
+    const int stride = imgdata->chunks.params.stride;
+    const int idx_px_re_max = idx_px_re + num_re - 1;
+    const int idx_px_im_max = idx_px_im + num_im - 1;
+    const float itrs = chunk->data[idx_px_re * stride + idx_px_im].itrs;
+
+    for (int idx_re = idx_px_re; idx_re <= idx_px_re_max; ++idx_re) {
+        const bool is_edge
+          = (idx_re == idx_px_re || idx_re == idx_px_re_max);
+        const int step = is_edge ? 1 : num_im - 1;
+        for (int idx_im = idx_px_im; idx_im <= idx_px_im_max; idx_im += step) {
+            const PixelData *const px = &chunk->data[idx_re * stride + idx_im];
+            if (px->state != PIXEL_STATE_VALID || px->itrs != itrs) {
+                return false;
+            }
+        }
+    }
+
+    *p_itrs = itrs;
+    return true;
+}
+
+/**
+ * Sets all pixels of `chunk` in the rectangle of `num_re` times `num_im` pixels
+ * from (`idx_px_re`, `idx_px_im`) on that are not valid yet to `itrs` and marks
+ * them by `flags`.
+ */
+static void
+_imageData_fill_chunk_rect(
+  const ImageData *imgdata, PixelChunk *chunk, int idx_px_re, int idx_px_im,
+  int num_re, int num_im, float itrs, unsigned int flags
+)
+{
+    const int stride = imgdata->chunks.params.stride;
+    const int idx_px_re_end = idx_px_re + num_re;
+    const int idx_px_im_end = idx_px_im + num_im;
+
+    for (int idx_re = idx_px_re; idx_re < idx_px_re_end; ++idx_re) {
+        for (int idx_im = idx_px_im; idx_im < idx_px_im_end; ++idx_im) {
+            PixelData *const px = &chunk->data[idx_re * stride + idx_im];
+            if (px->state == PIXEL_STATE_VALID) {
+                continue;
+            }
+            px->itrs = itrs;
+            px->state = PIXEL_STATE_VALID;
+            px->flags = flags;
+        }
+    }
+}
+
+/**
+ * Returns whether all pixels of `chunk` in the rectangle of `num_re` times
+ * `num_im` pixels from (`idx_px_re`, `idx_px_im`) on provably have the same
+ * number of iterations, which is written to `p_itrs`. The rectangle is iterated
+ * in interval arithmetic as a whole. Its enclosure is widened by half a pixel,
+ * which covers the rounding of the positions by any kernel.
+ */
+static bool
+_imageData_prove_chunk_rect(
+  const ImageData *imgdata, const PixelChunk *chunk, int idx_px_re,
+  int idx_px_im, int num_re, int num_im, float *p_itrs
+)
+{
+    static const double max_sqr
+      = ITERATION_CUTOFF_ABSOLUTE_VALUE * ITERATION_CUTOFF_ABSOLUTE_VALUE;
+
+    const ChunkData *const chunks = &imgdata->chunks;
+    const Settings *const settings = imgdata->settings;
+    const int idx_cntr_re = settings->width / 2;
+    const int idx_cntr_im = settings->height / 2;
+
+    const int idx_re = PixelChunk_get_idx_re(chunk, chunks, idx_px_re);
+    const int idx_im = PixelChunk_get_idx_im(chunk, chunks, idx_px_im);
+    const double offs_re_min = idx_re - idx_cntr_re - 0.5;
+    const double offs_im_min = idx_im - idx_cntr_im - 0.5;
+
+    const double upp = imgdata->view_d.upp;
+    const double cntr_re = imgdata->view_d.cntr_re;
+    const double cntr_im = imgdata->view_d.cntr_im;
+    const Interval re = Interval_from_bounds(
+      cntr_re + offs_re_min * upp, cntr_re + (offs_re_min + num_re) * upp
+    );
+    const Interval im = Interval_from_bounds(
+      cntr_im + offs_im_min * upp, cntr_im + (offs_im_min + num_im) * upp
+    );
+
+    PixelData px;
+    if (!PixelData_iterate_interval(&px, re, im, max_sqr, settings->max_itrs)) {
+        return false;
+    }
+
+    *p_itrs = px.itrs;
+    return true;
+}
+
+/**
+ * Updates all pixels of `chunk` in the rectangle of `num_re` times `num_im`
+ * pixels from (`idx_px_re`, `idx_px_im`) on by subdivision. The rectangle is
+ * filled at once if it is proven uniform in interval arithmetic (fill modes
+ * FILL_MODE_INTERVAL and FILL_MODE_VERIFY, if doubles resolve the view) or by
+ * the Mariani-Silver algorithm (fill modes FILL_MODE_BORDER and
+ * FILL_MODE_VERIFY): Only the border of the rectangle is iterated and its
+ * inside is filled if all border pixels have the same number of iterations. As
+ * the regions of equal iterations are simply connected, this only misses
+ * structures that slip through the border pixels (see FILL_MODE_VERIFY).
+ * Otherwise, the rectangle is split in halves along its longer side, which
+ * share the dividing line if borders are iterated. Rectangles smaller than
+ * FILL_MIN_SIZE are left as they are. Returns false if the time ran out before
+ * all border pixels were updated.
+ */
+static bool
+_imageData_subdivide_chunk_rect(
+  const ImageData *imgdata, PixelChunk *chunk, int idx_px_re, int idx_px_im,
+  int num_re, int num_im
+)
+{
+    const enum FillMode mode = imgdata->fill_mode;
+    const bool by_border
+      = (mode == FILL_MODE_BORDER || mode == FILL_MODE_VERIFY);
+    const bool by_interval
+      = (mode == FILL_MODE_INTERVAL || mode == FILL_MODE_VERIFY)
+        && imgdata->view_d.is_resolved;
+
+    if (num_re < FILL_MIN_SIZE || num_im < FILL_MIN_SIZE
+        || (!by_border && !by_interval))
+    {
+        return true;
+    }
+
+    float itrs = 0.0F;
+    if (by_interval
+        && _imageData_prove_chunk_rect(
+          imgdata, chunk, idx_px_re, idx_px_im, num_re, num_im, &itrs
+        ))
+    {
+        _imageData_fill_chunk_rect(
+          imgdata, chunk, idx_px_re, idx_px_im, num_re, num_im, itrs,
+          PIXEL_FLAG_FILLED | PIXEL_FLAG_PROVEN
+        );
+        return true;
+    }
+
+    if (by_border) {
+        const int idx_px_re_max = idx_px_re + num_re - 1;
+        const int idx_px_im_max = idx_px_im + num_im - 1;
+        if (!_imageData_update_chunk_rect(
+              imgdata, chunk, idx_px_re, idx_px_im, 1, num_im
+            )
+            || !_imageData_update_chunk_rect(
+              imgdata, chunk, idx_px_re_max, idx_px_im, 1, num_im
+            )
+            || !_imageData_update_chunk_rect(
+              imgdata, chunk, idx_px_re + 1, idx_px_im, num_re - 2, 1
+            )
+            || !_imageData_update_chunk_rect(
+              imgdata, chunk, idx_px_re + 1, idx_px_im_max, num_re - 2, 1
+            ))
+        {
+            return false;
+        }
+
+        if (_imageData_is_border_uniform(
+              imgdata, chunk, idx_px_re, idx_px_im, num_re, num_im, &itrs
+            ))
+        {
+            _imageData_fill_chunk_rect(
+              imgdata, chunk, idx_px_re, idx_px_im, num_re, num_im, itrs,
+              PIXEL_FLAG_FILLED
+            );
+            return true;
+        }
+    }
+
+    /* Halves share the dividing line if it has been iterated as border */
+    const int overlap = by_border ? 1 : 0;
+    if (num_re >= num_im) {
+        const int half = num_re / 2;
+        return _imageData_subdivide_chunk_rect(
+                 imgdata, chunk, idx_px_re, idx_px_im, half + overlap, num_im
+               )
+               && _imageData_subdivide_chunk_rect(
+                 imgdata, chunk, idx_px_re + half, idx_px_im, num_re - half,
+                 num_im
+               );
+    }
+
+    const int half = num_im / 2;
+    return _imageData_subdivide_chunk_rect(
+             imgdata, chunk, idx_px_re, idx_px_im, num_re, half + overlap
+           )
+           && _imageData_subdivide_chunk_rect(
+             imgdata, chunk, idx_px_re, idx_px_im + half, num_re,
+             num_im - half
+           );
+}
+
+/**
+ * Iterates all pixels of `chunk` marked by PIXEL_FLAG_FILLED and logs how many
+ * of them had been filled with a wrong number of iterations, separately for
+ * those marked by PIXEL_FLAG_PROVEN.
+ */
+static void
+_imageData_verify_filled_pixels(const ImageData *imgdata, PixelChunk *chunk)
+{
+    const ChunkData *const chunks = &imgdata->chunks;
+    const ChunkParams *const params = &chunks->params;
+    const int stride = params->stride;
+    const int num_px_re = params->num_px_re;
+    const int num_px_im = params->num_px_im;
+
+    int num_filled = 0;
+    int num_wrong = 0;
+    int num_proven = 0;
+    int num_wrong_proven = 0;
+    for (int idx_px_re = 0; idx_px_re < num_px_re; ++idx_px_re) {
+        for (int idx_px_im = 0; idx_px_im < num_px_im; ++idx_px_im) {
+            PixelData *const px = &chunk->data[idx_px_re * stride + idx_px_im];
+            if ((px->flags & PIXEL_FLAG_FILLED) == 0) {
+                continue;
+            }
+
+            const float itrs = px->itrs;
+            const bool is_proven = ((px->flags & PIXEL_FLAG_PROVEN) != 0);
+            px->state = PIXEL_STATE_INVALID;
+            px->flags = PIXEL_FLAG_NONE;
+            _imageData_update_chunk_pixels(
+              imgdata, chunk, idx_px_re, idx_px_im
+            );
+
+            const bool is_wrong
+              = (px->state == PIXEL_STATE_VALID && px->itrs != itrs);
+            if (is_proven) {
+                ++num_proven;
+                num_wrong_proven += is_wrong;
+            } else {
+                ++num_filled;
+                num_wrong += is_wrong;
+            }
+        }
+    }
+
+    if (num_wrong > 0 || num_wrong_proven > 0) {
+        cutil_log_warn(
+          "Filled pixels wrongly in chunk (%i, %i): %i of %i by border, %i of "
+          "%i proven",
+          chunk->idx_re, chunk->idx_im, num_wrong, num_filled,
+          num_wrong_proven, num_proven
+        );
+    }
+}
+
+/**
+ * Marks the samples of `chunk` for the progressive pass with distance `step`
+ * that lie in a cell of the previous pass whose corners all have the same
+ * value as guessed, i.e., sets them to that value and marks them valid while
+ * the other samples are iterated.
+ */
+static void
+_imageData_guess_samples(const ImageData *imgdata, PixelChunk *chunk, int step)
+{
+    const ChunkParams *const params = &imgdata->chunks.params;
+    const int stride = params->stride;
+    const int num_px_re = params->num_px_re;
+    const int num_px_im = params->num_px_im;
+    const int cell = 2 * step;
+
+    for (int idx_px_re = 0; idx_px_re < num_px_re; idx_px_re += step) {
+        const int idx_min_re = idx_px_re - idx_px_re % cell;
+        const int idx_max_re = (idx_min_re + cell < num_px_re)
+                               ? idx_min_re + cell
+                               : idx_min_re;
+        for (int idx_px_im = 0; idx_px_im < num_px_im; idx_px_im += step) {
+            PixelData *const px = &chunk->data[idx_px_re * stride + idx_px_im];
+            if (px->state == PIXEL_STATE_VALID) {
+                continue;
+            }
+
+            const int idx_min_im = idx_px_im - idx_px_im % cell;
+            const int idx_max_im = (idx_min_im + cell < num_px_im)
+                                   ? idx_min_im + cell
+                                   : idx_min_im;
+            const float itrs
+              = chunk->data[idx_min_re * stride + idx_min_im].itrs;
+            if (chunk->data[idx_max_re * stride + idx_min_im].itrs != itrs
+                || chunk->data[idx_min_re * stride + idx_max_im].itrs != itrs
+                || chunk->data[idx_max_re * stride + idx_max_im].itrs != itrs)
+            {
+                continue;
+            }
+
+            px->itrs = itrs;
+            px->state = PIXEL_STATE_VALID;
+            px->flags = PIXEL_FLAG_GUESSED;
+        }
+    }
+}
+
+/**
+ * Marks the guessed samples of `chunk` for the progressive pass with distance
+ * `step` as interpolated again, so that later passes iterate them.
+ */
+static void
+_imageData_unguess_samples(
+  const ImageData *imgdata, PixelChunk *chunk, int step
+)
+{
+    const ChunkParams *const params = &imgdata->chunks.params;
+    const int stride = params->stride;
+    const int num_px_re = params->num_px_re;
+    const int num_px_im = params->num_px_im;
+
+    for (int idx_px_re = 0; idx_px_re < num_px_re; idx_px_re += step) {
+        for (int idx_px_im = 0; idx_px_im < num_px_im; idx_px_im += step) {
+            PixelData *const px = &chunk->data[idx_px_re * stride + idx_px_im];
+            if ((px->flags & PIXEL_FLAG_GUESSED) != 0) {
+                px->state = PIXEL_STATE_INTERPOLATED;
+                px->flags = PIXEL_FLAG_NONE;
+            }
+        }
+    }
+}
+
+/**
+ * Updates every `step`-th pixel of `chunk` in both directions that is not
+ * valid yet. Returns false if the time ran out before all of them were
+ * updated.
+ */
+static bool
+_imageData_iterate_samples(
+  const ImageData *imgdata, PixelChunk *chunk, int step
+)
+{
+    const ChunkParams *const params = &imgdata->chunks.params;
+    const int num_px_re = params->num_px_re;
+    const int num_px_im = params->num_px_im;
+
+    for (int idx_px_re = 0; idx_px_re < num_px_re; idx_px_re += step) {
+        if (imgdata->kernel == PIXEL_KERNEL_DOUBLE) {
+            const int num = (num_px_im + step - 1) / step;
+            _imageData_update_chunk_segments(
+              imgdata, chunk, idx_px_re, 0, num, false, step
+            );
+            if (SDL_GetTicks64() > imgdata->target_ticks) {
+                return false;
+            }
+            continue;
+        }
+        for (int idx_px_im = 0; idx_px_im < num_px_im; idx_px_im += step) {
+            _imageData_update_chunk_pixels(
+              imgdata, chunk, idx_px_re, idx_px_im
+            );
+            if (SDL_GetTicks64() > imgdata->target_ticks) {
+                return false;
+            }
+        }
     }
-    free(imgdata->data);
-    free(imgdata->framebuf);
-    Settings_free(imgdata->settings);
-    free(imgdata->view_fname);
+
+    return true;
 }
 
-static void
-_imageData_clear_tbuf(ImageData *imgdata)
+/**
+ * Updates the samples of `chunk` for the progressive pass with distance `step`,
+ * i.e., every `step`-th pixel in both directions, and corrects glitches among
+ * them. Samples of earlier passes are valid already and thus skipped, as are
+ * samples whose value can be guessed from the previous pass. Returns false if
+ * the time ran out before all samples were updated.
+ */
+static bool
+_imageData_sample_chunk(const ImageData *imgdata, PixelChunk *chunk, int step)
 {
-    const int tnum = imgdata->tnum;
-    for (int i = 0; i < tnum; ++i) {
-        PixelDataBuffer_clear(&imgdata->tbuf[i]);
+    const bool is_guessing = (step < PROGRESSIVE_MAX_STEP);
+    if (is_guessing) {
+        _imageData_guess_samples(imgdata, chunk, step);
     }
-    free(imgdata->tbuf);
-}
 
-static void
-_imageData_clear_chunks(ImageData *imgdata)
-{
-    ChunkData *const chunks = &imgdata->chunks;
-    ChunkData_clear(chunks);
-}
+    const bool is_sampled = _imageData_iterate_samples(imgdata, chunk, step);
 
-static void
-_imageData_clear(ImageData *imgdata)
-{
-    _imageData_clear_mpf(imgdata);
-    _imageData_clear_view(imgdata);
-    _imageData_clear_data(imgdata);
-    _imageData_clear_tbuf(imgdata);
-    _imageData_clear_chunks(imgdata);
-}
+    if (is_guessing) {
+        _imageData_unguess_samples(imgdata, chunk, step);
+    }
 
-static void
-_imageData_set_prec_mpf(ImageData *imgdata)
-{
-    const mp_bitcnt_t prec = imgdata->prec;
-    mpf_set_prec(imgdata->action_buf, prec);
-}
+    if (!is_sampled) {
+        return false;
+    }
 
-static void
-_imageData_set_prec_view(ImageData *imgdata)
-{
-    const mp_bitcnt_t prec = imgdata->prec;
-    View_set_precision(imgdata->view, prec);
+    /* Glitches only occur with perturbation */
+    return !_imageData_is_kernel_perturbative(imgdata->kernel)
+           || _imageData_correct_glitches(imgdata, chunk);
 }
 
+/**
+ * Sets all pixels of the interpolated `chunk` that are not valid to the value
+ * of the closest sample of its last pass whose indices are not greater, i.e.,
+ * replicates the samples, and marks them as interpolated so that later passes
+ * iterate them.
+ */
 static void
-_imageData_set_prec_data(ImageData *imgdata)
+_imageData_interpolate_chunk(const ImageData *imgdata, PixelChunk *chunk)
 {
-    const Settings *const settings = imgdata->settings;
-    const int num_tot = settings->width * settings->height;
-    const mp_bitcnt_t prec = imgdata->prec;
-    for (int i = 0; i < num_tot; ++i) {
-        PixelData_set_prec(&imgdata->data[i], prec);
+    const ChunkParams *const params = &imgdata->chunks.params;
+    const int stride = params->stride;
+    const int num_px_re = params->num_px_re;
+    const int num_px_im = params->num_px_im;
+    const int step = chunk->step;
+
+    for (int idx_px_re = 0; idx_px_re < num_px_re; ++idx_px_re) {
+        const int idx_sample_re = idx_px_re - idx_px_re % step;
+        for (int idx_px_im = 0; idx_px_im < num_px_im; ++idx_px_im) {
+            PixelData *const px = &chunk->data[idx_px_re * stride + idx_px_im];
+            if (px->state == PIXEL_STATE_VALID) {
+                continue;
+            }
+            const int idx_sample_im = idx_px_im - idx_px_im % step;
+            const int idx_sample = idx_sample_re * stride + idx_sample_im;
+            px->itrs = chunk->data[idx_sample].itrs;
+            px->state = PIXEL_STATE_INTERPOLATED;
+        }
     }
 }
 
-static void
-_imageData_set_prec_tbuf(ImageData *imgdata)
+/**
+ * Returns whether the row `idx_im` of `imgdata` is a copy of its conjugate row.
+ * These are the rows of the smaller half of the image with respect to the real
+ * axis, whose conjugates are thus guaranteed to be in the larger half.
+ */
+static bool
+_imageData_is_row_mirrored(const ImageData *imgdata, int idx_im)
 {
-    const mp_bitcnt_t prec = imgdata->prec;
-    const int tnum = imgdata->tnum;
-    for (int i = 0; i < tnum; ++i) {
-        PixelDataBuffer *const buf = &imgdata->tbuf[i];
-        PixelDataBuffer_set_prec(buf, prec);
+    const int height = imgdata->settings->height;
+    const int offs = imgdata->mirror_offs;
+    const int idx_mirror = offs - idx_im;
+    if (offs < 0 || idx_im < 0 || idx_im >= height || idx_mirror < 0
+        || idx_mirror >= height)
+    {
+        return false;
     }
+    return (offs < height) ? (idx_im < idx_mirror) : (idx_im > idx_mirror);
 }
 
-static void
-_imageData_set_prec(ImageData *imgdata, mp_bitcnt_t prec)
+/**
+ * Returns whether all rows of `chunk` are copies of their conjugate rows.
+ */
+static bool
+_imageData_is_chunk_mirrored(const ImageData *imgdata, const PixelChunk *chunk)
 {
-    imgdata->prec = prec;
-    _imageData_set_prec_mpf(imgdata);
-    _imageData_set_prec_view(imgdata);
-    _imageData_set_prec_data(imgdata);
-    _imageData_set_prec_tbuf(imgdata);
+    const ChunkData *const chunks = &imgdata->chunks;
+    const int num_px_im = chunks->params.num_px_im;
+    const int idx_im_min = PixelChunk_get_idx_im(chunk, chunks, 0);
+    const int idx_im_max = idx_im_min + num_px_im - 1;
+    return _imageData_is_row_mirrored(imgdata, idx_im_min)
+           && _imageData_is_row_mirrored(imgdata, idx_im_max);
 }
 
+/**
+ * Copies all pixels of the mirrored `chunk` from their conjugate pixels if the
+ * (at most two) chunks containing them have been updated at least coarsely. The
+ * state of `chunk` is that of the coarser one.
+ */
 static void
-_imageData_update_chunk_pixels(
-  const ImageData *imgdata, PixelChunk *chunk, int idx_px_re, int idx_px_im
-)
+_imageData_mirror_chunk(const ImageData *imgdata, PixelChunk *chunk)
 {
     const ChunkData *const chunks = &imgdata->chunks;
     const ChunkParams *const params = &chunks->params;
-
     const int stride = params->stride;
-    const int idx_px = idx_px_re * stride + idx_px_im;
-    PixelData *const px = &chunk->data[idx_px];
+    const int num_px_re = params->num_px_re;
+    const int num_px_im = params->num_px_im;
 
-    if (px->state == PIXEL_STATE_VALID) {
+    const int offs = imgdata->mirror_offs;
+    const int idx_re_min = PixelChunk_get_idx_re(chunk, chunks, 0);
+    const int idx_im_min = PixelChunk_get_idx_im(chunk, chunks, 0);
+    const int idx_mirror_max = offs - idx_im_min;
+    const int idx_mirror_min = idx_mirror_max - num_px_im + 1;
+
+    const PixelChunk *const src_min
+      = ChunkData_get_chunk_of_pixel(chunks, idx_re_min, idx_mirror_min);
+    const PixelChunk *const src_max
+      = ChunkData_get_chunk_of_pixel(chunks, idx_re_min, idx_mirror_max);
+    if (src_min->state == CHUNK_STATE_INVALID
+        || src_max->state == CHUNK_STATE_INVALID)
+    {
         return;
     }
 
-    PixelDataBuffer *const tbuf = imgdata->tbuf;
-    const Settings *const settings = imgdata->settings;
-
-    const View *const view = imgdata->view;
-    const mpf_srcptr cntr_re = view->cntr_re;
-    const mpf_srcptr cntr_im = view->cntr_im;
-    const mpf_srcptr upp = view->upp;
-
-    const int num_re = settings->width;
-    const int num_im = settings->height;
-    const int idx_cntr_re = num_re / 2;
-    const int idx_cntr_im = num_im / 2;
-
-    const int idx_re = chunk->idx_re * params->num_px_re + idx_px_re;
-    const int idx_im = chunk->idx_im * params->num_px_im + idx_px_im;
-
-    mpf_set_d(px->re, (1.0 * (idx_re - idx_cntr_re)));
-    mpf_mul(px->re, px->re, upp);
-    mpf_add(px->re, px->re, cntr_re);
-
-    mpf_set_d(px->im, (1.0 * (idx_im - idx_cntr_im)));
-    mpf_mul(px->im, px->im, upp);
-    mpf_add(px->im, px->im, cntr_im);
-
-    const int tid = omp_get_thread_num();
-    PixelDataBuffer *const buf = &tbuf[tid];
-    PixelData_iterate(px, buf, settings->max_itrs);
+    for (int idx_px_re = 0; idx_px_re < num_px_re; ++idx_px_re) {
+        const int idx_re = idx_re_min + idx_px_re;
+        for (int idx_px_im = 0; idx_px_im < num_px_im; ++idx_px_im) {
+            const int idx_mirror = idx_mirror_max - idx_px_im;
+            const PixelData *const src_px
+              = ChunkData_get_pixel(chunks, idx_re, idx_mirror);
+            PixelData *const px = &chunk->data[idx_px_re * stride + idx_px_im];
+            px->itrs = src_px->itrs;
+            px->state = src_px->state;
+            px->flags = src_px->flags | PIXEL_FLAG_MIRRORED;
+        }
+    }
 
-    px->state = PIXEL_STATE_VALID;
+    const PixelChunk *const coarser
+      = (src_min->state == CHUNK_STATE_INTERPOLATED
+         && (src_max->state != CHUNK_STATE_INTERPOLATED
+             || src_min->step > src_max->step))
+          ? src_min
+          : src_max;
+    chunk->state = coarser->state;
+    chunk->step = coarser->step;
 }
 
 static void
@@ -305,13 +2301,14 @@ _imageData_register_zoom(ImageData *imgdata, int stages)
         (stages > 0) ? mpf_mul(upp, upp, buf) : mpf_div(upp, upp, buf);
     }
 
-    const mp_bitcnt_t new_prec = Util_calculate_new_prec(upp);
+    const mp_bitcnt_t new_prec = _imageData_get_new_prec(imgdata);
     if (new_prec != imgdata->prec) {
         _imageData_set_prec(imgdata, new_prec);
     }
 
-    PixelChunk_callback *const callback = &PixelChunk_callback_zoom;
-    _imageData_apply_to_all_chunks(imgdata, callback, &stages);
+    _imageData_update_kernel(imgdata);
+
+    ChunkData_zoom(&imgdata->chunks, stages);
 
     cutil_log_debug("Performed zoom: %i", stages);
 }
@@ -319,7 +2316,6 @@ _imageData_register_zoom(ImageData *imgdata, int stages)
 static void
 _imageData_register_shift(ImageData *imgdata, int shift_re, int shift_im)
 {
-    const Settings *const settings = imgdata->settings;
     const mpf_ptr buf = imgdata->action_buf;
 
     View *const view = imgdata->view;
@@ -328,24 +2324,26 @@ _imageData_register_shift(ImageData *imgdata, int shift_re, int shift_im)
     const mpf_ptr upp = view->upp;
 
     if (shift_re != 0) {
-        const int num_px_re = settings->width / settings->num_chnks_re;
-        const long int offs_re = shift_re * num_px_re;
-        mpf_set_si(buf, offs_re);
+        mpf_set_si(buf, shift_re);
         mpf_mul(buf, buf, upp);
         mpf_add(cntr_re, cntr_re, buf);
     }
 
     if (shift_im != 0) {
-        const int num_px_im = settings->height / settings->num_chnks_im;
-        const long int offs_im = shift_im * num_px_im;
-        mpf_set_si(buf, offs_im);
+        mpf_set_si(buf, shift_im);
         mpf_mul(buf, buf, upp);
         mpf_add(cntr_im, cntr_im, buf);
     }
 
-    PixelChunk_callback *const callback = &PixelChunk_callback_shift;
-    const int shifts[] = {shift_re, shift_im};
-    _imageData_apply_to_all_chunks(imgdata, callback, shifts);
+    /* Positions need more bits further away from the origin */
+    const mp_bitcnt_t new_prec = _imageData_get_new_prec(imgdata);
+    if (new_prec != imgdata->prec) {
+        _imageData_set_prec(imgdata, new_prec);
+    }
+
+    _imageData_update_kernel(imgdata);
+
+    ChunkData_shift(&imgdata->chunks, shift_re, shift_im);
 
     cutil_log_debug("Performed shift: %i %i", shift_re, shift_im);
 }
@@ -353,13 +2351,52 @@ _imageData_register_shift(ImageData *imgdata, int shift_re, int shift_im)
 static void
 _imageData_register_reset(ImageData *imgdata)
 {
+    _imageData_clear_view(imgdata);
     _imageData_init_view(imgdata);
+    _imageData_set_prec(imgdata, _imageData_get_new_prec(imgdata));
+    _imageData_update_kernel(imgdata);
     PixelChunk_callback *const callback = &PixelChunk_callback_reset;
     _imageData_apply_to_all_chunks(imgdata, callback, NULL);
 
     cutil_log_debug("Performed reset");
 }
 
+static void
+_imageData_register_toggle_bla(ImageData *imgdata)
+{
+    imgdata->use_bla = !imgdata->use_bla;
+
+    /* Only the deep-zoom paths are affected */
+    if (imgdata->kernel == PIXEL_KERNEL_PERTURBATION
+        || imgdata->kernel == PIXEL_KERNEL_FLOATEXP)
+    {
+        PixelChunk_callback *const callback = &PixelChunk_callback_reset;
+        _imageData_apply_to_all_chunks(imgdata, callback, NULL);
+    }
+
+    cutil_log_debug("%s BLA", imgdata->use_bla ? "Enabled" : "Disabled");
+}
+
+static void
+_imageData_register_snap_nucleus(ImageData *imgdata)
+{
+    if (!_imageData_find_nucleus(imgdata)) {
+        cutil_log_debug("No nucleus found");
+        return;
+    }
+
+    View *const view = imgdata->view;
+    const Nucleus *const nucleus = &imgdata->nucleus;
+    mpf_set(view->cntr_re, nucleus->re);
+    mpf_set(view->cntr_im, nucleus->im);
+
+    _imageData_update_kernel(imgdata);
+    PixelChunk_callback *const callback = &PixelChunk_callback_reset;
+    _imageData_apply_to_all_chunks(imgdata, callback, NULL);
+
+    cutil_log_debug("Snapped to nucleus of period %i", nucleus->period);
+}
+
 static void
 _imageData_register_view_save(ImageData *imgdata)
 {
@@ -378,6 +2415,13 @@ _imageData_register_view_load(ImageData *imgdata)
     char *const fname = imgdata->view_fname;
 
     JsonUtil_read(view, fname, &View_fill_from_Json_void);
+
+    /* The stored precision may not suffice for the current settings */
+    const mp_bitcnt_t new_prec = _imageData_get_new_prec(imgdata);
+    _imageData_set_prec(
+      imgdata, (new_prec > view->prec) ? new_prec : view->prec
+    );
+    _imageData_update_kernel(imgdata);
     PixelChunk_callback *const callback = &PixelChunk_callback_reset;
     _imageData_apply_to_all_chunks(imgdata, callback, NULL);
 
@@ -394,6 +2438,8 @@ _imageData_update_framebuffer(ImageData *imgdata)
     const int num_chnks_re = chunks->num_re;
     const int num_chnks_im = chunks->num_im;
     const int num_chnks_tot = num_chnks_re * num_chnks_im;
+    const int width = chunks->width;
+    const int height = chunks->height;
 
     const ChunkParams *const params = &chunks->params;
     const int stride = params->stride;
@@ -404,28 +2450,128 @@ _imageData_update_framebuffer(ImageData *imgdata)
 #pragma omp parallel for private(idx_chnk)
     for (idx_chnk = 0; idx_chnk < num_chnks_tot; ++idx_chnk) {
         const PixelChunk *const chunk = &chunks->data[idx_chnk];
+        const int idx_re_min = PixelChunk_get_idx_re(chunk, chunks, 0);
+        const int idx_im_min = PixelChunk_get_idx_im(chunk, chunks, 0);
         for (int idx_px_re = 0; idx_px_re < num_px_re; ++idx_px_re) {
+            const int idx_abs_re = idx_re_min + idx_px_re;
+            if (idx_abs_re < 0 || idx_abs_re >= width) {
+                continue;
+            }
             for (int idx_px_im = 0; idx_px_im < num_px_im; ++idx_px_im) {
+                const int idx_abs_im = idx_im_min + idx_px_im;
+                if (idx_abs_im < 0 || idx_abs_im >= height) {
+                    continue;
+                }
+
                 const int idx_rel = idx_px_re * stride + idx_px_im;
                 const PixelData *const px = &chunk->data[idx_rel];
-
-                const int idx_abs_re = chunk->idx_re * num_px_re + idx_px_re;
-                const int idx_abs_im = chunk->idx_im * num_px_im + idx_px_im;
-                const int idx_abs = idx_abs_re * stride + idx_abs_im;
+                const int idx_abs = idx_abs_re * height + idx_abs_im;
                 imgdata->framebuf[idx_abs] = px->itrs;
             }
         }
     }
 }
 
+/**
+ * Fills all chunks of `imgdata` that are mirrored at the real axis and not
+ * valid yet from their conjugate chunks, which have been updated beforehand.
+ */
+static void
+_imageData_mirror_chunks(ImageData *imgdata)
+{
+    if (imgdata->mirror_offs < 0) {
+        return;
+    }
+
+    ChunkData *const chunks = &imgdata->chunks;
+    const int num_tot = chunks->num_re * chunks->num_im;
+    for (int idx = 0; idx < num_tot; ++idx) {
+        PixelChunk *const chunk = &chunks->data[idx];
+        if (chunk->state != CHUNK_STATE_VALID
+            && _imageData_is_chunk_mirrored(imgdata, chunk))
+        {
+            _imageData_mirror_chunk(imgdata, chunk);
+        }
+    }
+}
+
+/**
+ * Halves the distance of the pixels iterated in the progressive passes of
+ * `imgdata` if all chunks have completed the current pass, except for mirrored
+ * chunks, which follow their conjugates. Returns whether there is a next pass
+ * to perform.
+ */
+static bool
+_imageData_refine_step(ImageData *imgdata)
+{
+    if (imgdata->step <= 1) {
+        return false;
+    }
+
+    const ChunkData *const chunks = &imgdata->chunks;
+    const int num_tot = chunks->num_re * chunks->num_im;
+    for (int idx = 0; idx < num_tot; ++idx) {
+        const PixelChunk *const chunk = &chunks->data[idx];
+        const bool is_pending
+          = (chunk->state == CHUNK_STATE_INVALID
+             || (chunk->state == CHUNK_STATE_INTERPOLATED
+                 && chunk->step > imgdata->step));
+        if (is_pending && PixelChunk_is_visible(chunk, chunks)
+            && !_imageData_is_chunk_mirrored(imgdata, chunk))
+        {
+            return false;
+        }
+    }
+
+    imgdata->step /= 2;
+    return true;
+}
+
+/**
+ * Interpolates the pixels of all chunks of `imgdata` that have only been
+ * updated coarsely, except for mirrored chunks, which are copied afterwards.
+ * This is only done once per frame, as the pixels are overwritten by the
+ * next pass anyway.
+ */
+static void
+_imageData_interpolate_chunks(ImageData *imgdata)
+{
+    ChunkData *const chunks = &imgdata->chunks;
+    const int num_tot = chunks->num_re * chunks->num_im;
+    for (int idx = 0; idx < num_tot; ++idx) {
+        PixelChunk *const chunk = &chunks->data[idx];
+        if (chunk->state == CHUNK_STATE_INTERPOLATED
+            && !_imageData_is_chunk_mirrored(imgdata, chunk))
+        {
+            _imageData_interpolate_chunk(imgdata, chunk);
+        }
+    }
+}
+
 static void
 _imageData_update_pixels(ImageData *imgdata)
 {
     PixelChunk_callback *const callback = &PixelChunk_callback_update;
-    _imageData_apply_to_all_chunks(imgdata, callback, imgdata);
+    do {
+        _imageData_apply_to_all_chunks(imgdata, callback, imgdata);
+    } while (_imageData_refine_step(imgdata)
+             && SDL_GetTicks64() <= imgdata->target_ticks);
+    _imageData_interpolate_chunks(imgdata);
+    _imageData_mirror_chunks(imgdata);
     _imageData_update_framebuffer(imgdata);
 }
 
+/**
+ * Returns whether `chunk` has to be updated in the current state of `imgdata`,
+ * i.e., whether it is visible or the margin chunks are being prefetched.
+ */
+static bool
+_imageData_is_chunk_required(const ImageData *imgdata, const PixelChunk *chunk)
+{
+    return imgdata->state == DATA_STATE_PREFETCHING
+           || PixelChunk_is_visible(chunk, &imgdata->chunks);
+}
+
 static bool
 _imageData_is_complete(ImageData *imgdata)
 {
@@ -433,13 +2579,33 @@ _imageData_is_complete(ImageData *imgdata)
     const int num_tot = chunks->num_re * chunks->num_im;
     for (int idx = 0; idx < num_tot; ++idx) {
         PixelChunk *const chunk = &chunks->data[idx];
-        if (chunk->state == CHUNK_STATE_INVALID) {
+        if (chunk->state != CHUNK_STATE_VALID
+            && _imageData_is_chunk_required(imgdata, chunk))
+        {
             return false;
         }
     }
     return true;
 }
 
+/**
+ * Updates the chunks in the margin around the complete image of `imgdata` in
+ * advance, so that shifting the image reveals chunks that are already valid.
+ * Margin chunks mirrored at the real axis are copied from their conjugates.
+ * The image itself does not change, so the framebuffer is left as it is.
+ */
+static void
+_imageData_prefetch_chunks(ImageData *imgdata)
+{
+    PixelChunk_callback *const callback = &PixelChunk_callback_update;
+    _imageData_apply_to_all_chunks(imgdata, callback, imgdata);
+    _imageData_mirror_chunks(imgdata);
+    if (_imageData_is_complete(imgdata)) {
+        imgdata->state = DATA_STATE_IDLE;
+        cutil_log_debug("Prefetched margin chunks");
+    }
+}
+
 ImageData *
 ImageData_create(const Settings *settings)
 {
@@ -462,10 +2628,12 @@ void
 ImageData_register_action(ImageData *imgdata, enum Key key)
 {
     static const int ZOOM_STAGES = 1;
-    static const int SHIFT_STAGES = 2;
+    static const int SHIFT_DIVISOR = 40; /* Fraction of the image per shift */
     if (imgdata->state == DATA_STATE_WORKING) {
         return;
     }
+    const int shift_re = imgdata->settings->width / SHIFT_DIVISOR;
+    const int shift_im = imgdata->settings->height / SHIFT_DIVISOR;
     switch (key) {
     case KEY_ZOOM_IN: {
         _imageData_register_zoom(imgdata, +ZOOM_STAGES);
@@ -474,16 +2642,16 @@ ImageData_register_action(ImageData *imgdata, enum Key key)
         _imageData_register_zoom(imgdata, -ZOOM_STAGES);
     } break;
     case KEY_UP: {
-        _imageData_register_shift(imgdata, 0, -SHIFT_STAGES);
+        _imageData_register_shift(imgdata, 0, -shift_im);
     } break;
     case KEY_DOWN: {
-        _imageData_register_shift(imgdata, 0, +SHIFT_STAGES);
+        _imageData_register_shift(imgdata, 0, +shift_im);
     } break;
     case KEY_LEFT: {
-        _imageData_register_shift(imgdata, -SHIFT_STAGES, 0);
+        _imageData_register_shift(imgdata, -shift_re, 0);
     } break;
     case KEY_RIGHT: {
-        _imageData_register_shift(imgdata, +SHIFT_STAGES, 0);
+        _imageData_register_shift(imgdata, +shift_re, 0);
     } break;
     case KEY_RESET: {
         _imageData_register_reset(imgdata);
@@ -494,10 +2662,18 @@ ImageData_register_action(ImageData *imgdata, enum Key key)
     case KEY_VIEW_LOAD: {
         _imageData_register_view_load(imgdata);
     } break;
+    case KEY_TOGGLE_BLA: {
+        _imageData_register_toggle_bla(imgdata);
+    } break;
+    case KEY_SNAP_NUCLEUS: {
+        _imageData_register_snap_nucleus(imgdata);
+    } break;
     default:
         return;
     }
     imgdata->state = DATA_STATE_WORKING;
+    imgdata->step = (imgdata->num_frames > 1) ? PROGRESSIVE_MAX_STEP : 1;
+    imgdata->num_frames = 0;
 }
 
 int
@@ -508,17 +2684,34 @@ ImageData_perform_action(ImageData *imgdata, unsigned int mseconds)
         return 0;
     }
     imgdata->target_ticks = SDL_GetTicks64() + mseconds;
+    if (imgdata->state == DATA_STATE_PREFETCHING) {
+        _imageData_prefetch_chunks(imgdata);
+        return 0;
+    }
+    ++imgdata->num_frames;
     _imageData_update_pixels(imgdata);
     if (_imageData_is_complete(imgdata)) {
-        imgdata->state = DATA_STATE_IDLE;
+        /* Margin chunks are only computed in full detail */
+        imgdata->state = DATA_STATE_PREFETCHING;
+        imgdata->step = 1;
     }
     return 1;
 }
 
+bool
+ImageData_is_idle(const ImageData *imgdata)
+{
+    return imgdata->state == DATA_STATE_IDLE;
+}
+
 void
 ImageData_update_chunk(const ImageData *imgdata, PixelChunk *chunk)
 {
-    if (chunk->state == CHUNK_STATE_VALID) {
+    /* Mirrored chunks are copied once their conjugates are valid */
+    if (chunk->state == CHUNK_STATE_VALID
+        || !_imageData_is_chunk_required(imgdata, chunk)
+        || _imageData_is_chunk_mirrored(imgdata, chunk))
+    {
         return;
     }
 
@@ -527,15 +2720,46 @@ ImageData_update_chunk(const ImageData *imgdata, PixelChunk *chunk)
     const int num_px_re = params->num_px_re;
     const int num_px_im = params->num_px_im;
 
-    for (int idx_px_re = 0; idx_px_re < num_px_re; ++idx_px_re) {
-        for (int idx_px_im = 0; idx_px_im < num_px_im; ++idx_px_im) {
-            _imageData_update_chunk_pixels(
-              imgdata, chunk, idx_px_re, idx_px_im
-            );
-            if (SDL_GetTicks64() > imgdata->target_ticks) {
-                return;
-            }
+    if (imgdata->kernel == PIXEL_KERNEL_PERTURBATION
+        && chunk->skipped_itrs < 0)
+    {
+        chunk->skipped_itrs = _imageData_get_chunk_skip(imgdata, chunk);
+    }
+
+    /* Coarse passes only iterate samples and replicate them */
+    const int step = imgdata->step;
+    if (step > 1) {
+        const bool is_done
+          = (chunk->state == CHUNK_STATE_INTERPOLATED && chunk->step <= step);
+        if (!is_done && _imageData_sample_chunk(imgdata, chunk, step)) {
+            chunk->state = CHUNK_STATE_INTERPOLATED;
+            chunk->step = step;
         }
+        return;
+    }
+
+    if (imgdata->fill_mode != FILL_MODE_OFF
+        && !_imageData_subdivide_chunk_rect(
+          imgdata, chunk, 0, 0, num_px_re, num_px_im
+        ))
+    {
+        return;
+    }
+
+    /* Pixels that have not been filled are updated row by row */
+    if (!_imageData_update_chunk_rect(
+          imgdata, chunk, 0, 0, num_px_re, num_px_im
+        ))
+    {
+        return;
+    }
+
+    if (imgdata->fill_mode == FILL_MODE_VERIFY) {
+        _imageData_verify_filled_pixels(imgdata, chunk);
+    }
+
+    if (!_imageData_correct_glitches(imgdata, chunk)) {
+        return;
     }
 
     chunk->state = CHUNK_STATE_VALID;
@@ -546,3 +2770,31 @@ ImageData_get_pixel_data(const ImageData *imgdata)
 {
     return imgdata->framebuf;
 }
+
+int
+ImageData_get_skipped_itrs(const ImageData *imgdata)
+{
+    if (imgdata->kernel != PIXEL_KERNEL_PERTURBATION) {
+        return 0;
+    }
+
+    const ChunkData *const chunks = &imgdata->chunks;
+    const int num_tot = chunks->num_re * chunks->num_im;
+    int skipped_itrs = -1;
+    for (int idx = 0; idx < num_tot; ++idx) {
+        const PixelChunk *const chunk = &chunks->data[idx];
+        if (chunk->skipped_itrs < 0) {
+            continue;
+        }
+        if (skipped_itrs < 0 || chunk->skipped_itrs < skipped_itrs) {
+            skipped_itrs = chunk->skipped_itrs;
+        }
+    }
+    return (skipped_itrs > 0) ? skipped_itrs : 0;
+}
+
+const ReferenceOrbit *
+ImageData_get_reference_orbit(const ImageData *imgdata)
+{
+    return imgdata->is_orbit_valid ? &imgdata->orbit : NULL;
+}
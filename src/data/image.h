@@ -10,6 +10,7 @@
 #include <app/key.h>
 #include <app/settings.h>
 #include <data/chunk.h>
+#include <data/orbit.h>
 
 /**
  * Opaque ImageData type
@@ -43,7 +44,9 @@ ImageData_register_action(ImageData *imgdata, enum Key key);
 
 /**
  * Performs registered action on `imgdata` for `mseconds`
- * milliseconds. Returns nonzero value if an action has been performed.
+ * milliseconds. Returns nonzero value if an action has been performed. Once
+ * the image is complete, the chunks in the margin around it are computed in
+ * advance, which does not count as an action.
  *
  * @param[in] imgdata ImageData object to perform action on
  * @param[in] mseconds pressed key
@@ -54,7 +57,22 @@ int
 ImageData_perform_action(ImageData *imgdata, unsigned int mseconds);
 
 /**
- * Updates all pixels in `chunk` of `imgdata`.
+ * Returns whether `imgdata` is complete, including the chunks in the margin
+ * around the image, so that there is nothing left to compute.
+ *
+ * @param[in] imgdata ImageData object to check
+ *
+ * @return true if `imgdata` is idle, false otherwise
+ */
+bool
+ImageData_is_idle(const ImageData *imgdata);
+
+/**
+ * Updates all pixels in `chunk` of `imgdata`. In the coarse passes of the
+ * progressive rendering, only every n-th pixel is iterated and the others are
+ * interpolated. Chunks outside of the image, unless the margin chunks are
+ * computed in advance, and chunks that are mirrored at the real axis are left
+ * as they are, the latter are copied from their conjugates.
  *
  * @param[in] imgdata ImageData object to update chunk of
  * @param[in] chunk PixelChunk to update
@@ -72,4 +90,28 @@ ImageData_update_chunk(const ImageData *imgdata, PixelChunk *chunk);
 const float *
 ImageData_get_pixel_data(const ImageData *imgdata);
 
+/**
+ * Returns the number of iterations skipped by the series approximation for
+ * every pixel in `imgdata`, i.e., the minimum over all chunks computed with the
+ * current reference orbit. Returns zero if no series approximation is used.
+ *
+ * @param[in] imgdata ImageData object to get number of skipped iterations of
+ *
+ * @return number of iterations skipped for every pixel in `imgdata`
+ */
+int
+ImageData_get_skipped_itrs(const ImageData *imgdata);
+
+/**
+ * Returns the reference orbit used by the perturbation kernels of `imgdata`,
+ * which is kept across shifts and zooms as long as its reference point is in
+ * view. Returns NULL if there is no valid reference orbit.
+ *
+ * @param[in] imgdata ImageData object to get reference orbit of
+ *
+ * @return reference orbit of `imgdata` or NULL
+ */
+const ReferenceOrbit *
+ImageData_get_reference_orbit(const ImageData *imgdata);
+
 #endif /* MANDELBROT_DATA_IMAGE_H_INCLUDED */
@@ -0,0 +1,276 @@
+#include <data/interior.h>
+
+#include <cutil/std/math.h>
+
+#include <data/pixel.h>
+
+/**
+ * Fraction of the size estimate of a component used as radius of the disk
+ * around its nucleus. The main cardioid of a component of size s contains
+ * the disk of radius s / 4, the factor leaves room for distortion.
+ */
+#define INTERIOR_DISK_SCALE 0.125
+
+/**
+ * Directions of the points on the boundary of a disk that have to remain
+ * bounded for the disk to be accepted
+ */
+#define INTERIOR_SQRT_HALF 0.70710678118654752
+
+static const double INTERIOR_CHECK_DIRS[][2] = {
+  {1.0, 0.0},
+  {INTERIOR_SQRT_HALF, INTERIOR_SQRT_HALF},
+  {0.0, 1.0},
+  {-INTERIOR_SQRT_HALF, INTERIOR_SQRT_HALF},
+  {-1.0, 0.0},
+  {-INTERIOR_SQRT_HALF, -INTERIOR_SQRT_HALF},
+  {0.0, -1.0},
+  {INTERIOR_SQRT_HALF, -INTERIOR_SQRT_HALF},
+};
+
+#define INTERIOR_NUM_CHECK_DIRS                                                \
+    ((sizeof INTERIOR_CHECK_DIRS) / (sizeof *INTERIOR_CHECK_DIRS))
+
+/**
+ * Maximum number of Newton steps and tolerance (relative to the size of the
+ * position) for the nucleus
+ */
+#define INTERIOR_MAX_NEWTON_STEPS 32
+#define INTERIOR_NEWTON_TOLERANCE 1.0e-14
+
+/**
+ * Absolute square beyond which the orbit escapes
+ */
+#define INTERIOR_ESCAPE_SQR 4.0
+
+bool
+Interior_is_in_cardioid(double re, double im)
+{
+    const double x = re - 0.25;
+    const double im_sqr = im * im;
+    const double q = x * x + im_sqr;
+    return (q * (q + x) < 0.25 * im_sqr);
+}
+
+bool
+Interior_is_in_bulb(double re, double im)
+{
+    const double x = re + 1.0;
+    return (x * x + im * im < 0.0625);
+}
+
+int
+Interior_find_atom_period(double re, double im, int max_period)
+{
+    double z_re = 0.0;
+    double z_im = 0.0;
+    double min_sqr = HUGE_VAL;
+    int period = 0;
+
+    for (int itrs = 1; itrs <= max_period; ++itrs) {
+        const double tmp_re = z_re * z_re - z_im * z_im + re;
+        z_im = 2.0 * z_re * z_im + im;
+        z_re = tmp_re;
+
+        const double z_sqr = z_re * z_re + z_im * z_im;
+        if (z_sqr > INTERIOR_ESCAPE_SQR) {
+            break;
+        }
+        /* The orbits of interior points keep approaching 0 at multiples */
+        if (z_sqr < min_sqr && (period < 2 || itrs % period != 0)) {
+            min_sqr = z_sqr;
+            period = itrs;
+        }
+    }
+
+    return period;
+}
+
+/**
+ * Refines the nucleus of period `period` starting at (`*p_re`, `*p_im`) by
+ * Newton's method. Returns whether it converged to a nucleus of exactly that
+ * period, i.e., not to one of a divisor of `period`.
+ */
+static bool
+_interior_find_nucleus(double *p_re, double *p_im, int period)
+{
+    double re = *p_re;
+    double im = *p_im;
+
+    for (int step = 0; step < INTERIOR_MAX_NEWTON_STEPS; ++step) {
+        double z_re = 0.0;
+        double z_im = 0.0;
+        double dz_re = 0.0;
+        double dz_im = 0.0;
+        for (int itrs = 0; itrs < period; ++itrs) {
+            /* dz_{n+1} = 2 z_n dz_n + 1 */
+            const double tmp_re = 2.0 * (z_re * dz_re - z_im * dz_im) + 1.0;
+            dz_im = 2.0 * (z_re * dz_im + z_im * dz_re);
+            dz_re = tmp_re;
+
+            const double sqr_re = z_re * z_re - z_im * z_im + re;
+            z_im = 2.0 * z_re * z_im + im;
+            z_re = sqr_re;
+        }
+
+        const double dz_sqr = dz_re * dz_re + dz_im * dz_im;
+        if (dz_sqr == 0.0 || !isfinite(dz_sqr)) {
+            return false;
+        }
+
+        /* c_{k+1} = c_k - z / dz */
+        const double step_re = (z_re * dz_re + z_im * dz_im) / dz_sqr;
+        const double step_im = (z_im * dz_re - z_re * dz_im) / dz_sqr;
+        re -= step_re;
+        im -= step_im;
+
+        const double tol = INTERIOR_NEWTON_TOLERANCE * (1.0 + hypot(re, im));
+        if (hypot(step_re, step_im) < tol) {
+            *p_re = re;
+            *p_im = im;
+            return (Interior_find_atom_period(re, im, period) == period);
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Returns the size estimate of the component of period `period` with nucleus
+ * (`re`, `im`), i.e., the scale of the component relative to the main
+ * cardioid.
+ */
+static double
+_interior_get_size(double re, double im, int period)
+{
+    double z_re = 0.0;
+    double z_im = 0.0;
+    double l_re = 1.0;
+    double l_im = 0.0;
+    double b_re = 1.0;
+    double b_im = 0.0;
+
+    for (int itrs = 1; itrs < period; ++itrs) {
+        const double sqr_re = z_re * z_re - z_im * z_im + re;
+        z_im = 2.0 * z_re * z_im + im;
+        z_re = sqr_re;
+
+        /* l_n = 2 z_n l_{n-1} and b_n = b_{n-1} + 1 / l_n */
+        const double tmp_re = 2.0 * (z_re * l_re - z_im * l_im);
+        l_im = 2.0 * (z_re * l_im + z_im * l_re);
+        l_re = tmp_re;
+
+        const double l_sqr = l_re * l_re + l_im * l_im;
+        b_re += l_re / l_sqr;
+        b_im -= l_im / l_sqr;
+    }
+
+    /* size = 1 / (b l^2) */
+    const double l_sqr = l_re * l_re + l_im * l_im;
+    return 1.0 / (hypot(b_re, b_im) * l_sqr);
+}
+
+bool
+Interior_find_disk(
+  InteriorDisk *disk, double re, double im, int period, uint16_t max_itrs
+)
+{
+    if (!_interior_find_nucleus(&re, &im, period)) {
+        return false;
+    }
+
+    const double size = _interior_get_size(re, im, period);
+    const double radius = INTERIOR_DISK_SCALE * size;
+    if (!(radius > 0.0) || !isfinite(radius)) {
+        return false;
+    }
+
+    /* Components are (nearly) star-shaped around their nuclei */
+    static const double max_sqr = INTERIOR_ESCAPE_SQR;
+    const double tol = PixelData_get_tolerance(0.0);
+    PixelData px = {0};
+    for (size_t i = 0; i < INTERIOR_NUM_CHECK_DIRS; ++i) {
+        const double pt_re = re + radius * INTERIOR_CHECK_DIRS[i][0];
+        const double pt_im = im + radius * INTERIOR_CHECK_DIRS[i][1];
+        PixelData_iterate_double(&px, pt_re, pt_im, max_sqr, tol, max_itrs);
+        if (px.itrs != 0.0F) {
+            return false;
+        }
+    }
+
+    disk->re = re;
+    disk->im = im;
+    disk->radius = radius;
+    disk->period = period;
+    return true;
+}
+
+void
+InteriorCache_init(InteriorCache *cache)
+{
+    cache->num = 0;
+    cache->next = 0;
+    cache->num_active = 0;
+}
+
+bool
+InteriorCache_add(InteriorCache *cache, const InteriorDisk *disk)
+{
+    for (int i = 0; i < cache->num; ++i) {
+        const InteriorDisk *const other = &cache->disks[i];
+        const double dist = hypot(disk->re - other->re, disk->im - other->im);
+        if (dist < other->radius) {
+            return false;
+        }
+    }
+
+    /* Active indices may refer to the replaced disk */
+    if (cache->num == INTERIOR_CACHE_SIZE) {
+        cache->num_active = 0;
+    }
+
+    cache->disks[cache->next] = *disk;
+    cache->next = (cache->next + 1) % INTERIOR_CACHE_SIZE;
+    if (cache->num < INTERIOR_CACHE_SIZE) {
+        ++cache->num;
+    }
+    return true;
+}
+
+void
+InteriorCache_select(
+  InteriorCache *cache, double re_min, double re_max, double im_min,
+  double im_max
+)
+{
+    cache->num_active = 0;
+    for (int i = 0; i < cache->num; ++i) {
+        const InteriorDisk *const disk = &cache->disks[i];
+        const double dist_re = fmax(re_min - disk->re, disk->re - re_max);
+        const double dist_im = fmax(im_min - disk->im, disk->im - im_max);
+        const double dist = hypot(fmax(dist_re, 0.0), fmax(dist_im, 0.0));
+        if (dist < disk->radius) {
+            cache->active[cache->num_active++] = i;
+        }
+    }
+}
+
+bool
+InteriorCache_contains(const InteriorCache *cache, double re, double im)
+{
+    if (Interior_is_in_cardioid(re, im) || Interior_is_in_bulb(re, im)) {
+        return true;
+    }
+
+    for (int i = 0; i < cache->num_active; ++i) {
+        const InteriorDisk *const disk = &cache->disks[cache->active[i]];
+        const double diff_re = re - disk->re;
+        const double diff_im = im - disk->im;
+        const double radius = disk->radius;
+        if (diff_re * diff_re + diff_im * diff_im < radius * radius) {
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,154 @@
+/* data/interior.h
+ *
+ * Header for the classification of interior points without iterating them
+ *
+ */
+
+#ifndef MANDELBROT_DATA_INTERIOR_H_INCLUDED
+#define MANDELBROT_DATA_INTERIOR_H_INCLUDED
+
+#include <inttypes.h>
+
+#include <cutil/std/stdbool.h>
+
+/**
+ * Maximum number of disks in InteriorCache
+ */
+#define INTERIOR_CACHE_SIZE 256
+
+/**
+ * Struct for a disk that lies inside a hyperbolic component of the Mandelbrot
+ * set
+ */
+typedef struct {
+    double re;     /* Real part of nucleus of component */
+    double im;     /* Imaginary part of nucleus of component */
+    double radius; /* Radius of disk around nucleus */
+    int period;    /* Period of component */
+} InteriorDisk;
+
+/**
+ * Struct for a cache of disks inside higher-period components. The cache
+ * outlives views, since the components do not change. Only the disks that
+ * intersect the current view are checked for each pixel.
+ */
+typedef struct {
+    InteriorDisk disks[INTERIOR_CACHE_SIZE]; /* Cached disks */
+    int num;                                 /* Number of cached disks */
+    int next;    /* Disk to overwrite next when the cache is full */
+    int active[INTERIOR_CACHE_SIZE]; /* Indices of disks in current view */
+    int num_active;                  /* Number of disks in current view */
+} InteriorCache;
+
+/**
+ * Returns whether (`re`, `im`) lies inside the main cardioid.
+ *
+ * @param[in] re real part of position
+ * @param[in] im imaginary part of position
+ *
+ * @return true if (`re`, `im`) lies inside the main cardioid, false otherwise
+ */
+bool
+Interior_is_in_cardioid(double re, double im);
+
+/**
+ * Returns whether (`re`, `im`) lies inside the period-2 bulb.
+ *
+ * @param[in] re real part of position
+ * @param[in] im imaginary part of position
+ *
+ * @return true if (`re`, `im`) lies inside the period-2 bulb, false otherwise
+ */
+bool
+Interior_is_in_bulb(double re, double im);
+
+/**
+ * Returns the period of the atom domain containing (`re`, `im`), i.e., the
+ * iteration up to `max_period` at which |z| is smallest before escaping.
+ * Multiples of the current candidate are skipped, since the orbit keeps
+ * approaching 0 at those for interior points. Returns 0 if the orbit escapes
+ * at the first iteration.
+ *
+ * @param[in] re real part of position
+ * @param[in] im imaginary part of position
+ * @param[in] max_period maximum period to check
+ *
+ * @return period of atom domain, 0 if there is none
+ */
+int
+Interior_find_atom_period(double re, double im, int max_period);
+
+/**
+ * Finds the hyperbolic component of period `period` near (`re`, `im`) by
+ * Newton's method for its nucleus and writes a disk inside of it to `disk`.
+ * The radius of the disk follows from the size estimate of the component. The
+ * disk is only accepted if no point on its boundary escapes within `max_itrs`
+ * iterations. Returns whether such a disk was found.
+ *
+ * @param[out] disk InteriorDisk to write result to
+ * @param[in] re real part of starting point
+ * @param[in] im imaginary part of starting point
+ * @param[in] period period of component
+ * @param[in] max_itrs maximum number of iterations for the boundary check
+ *
+ * @return true if a disk was found, false otherwise
+ */
+bool
+Interior_find_disk(
+  InteriorDisk *disk, double re, double im, int period, uint16_t max_itrs
+);
+
+/**
+ * Initializes fields in `cache`, which is empty afterwards.
+ *
+ * @param[in] cache InteriorCache object to initialize
+ */
+void
+InteriorCache_init(InteriorCache *cache);
+
+/**
+ * Adds `disk` to `cache` unless its nucleus already lies inside a cached disk.
+ * If `cache` is full, the oldest disk is replaced. The new disk is not active
+ * until the next call of `InteriorCache_select`.
+ *
+ * @param[in] cache InteriorCache object to add to
+ * @param[in] disk InteriorDisk to add
+ *
+ * @return true if `disk` was added, false otherwise
+ */
+bool
+InteriorCache_add(InteriorCache *cache, const InteriorDisk *disk);
+
+/**
+ * Activates exactly those disks of `cache` that intersect the rectangle
+ * [`re_min`, `re_max`] x [`im_min`, `im_max`].
+ *
+ * @param[in] cache InteriorCache object to select disks of
+ * @param[in] re_min minimum real part of rectangle
+ * @param[in] re_max maximum real part of rectangle
+ * @param[in] im_min minimum imaginary part of rectangle
+ * @param[in] im_max maximum imaginary part of rectangle
+ */
+void
+InteriorCache_select(
+  InteriorCache *cache, double re_min, double re_max, double im_min,
+  double im_max
+);
+
+/**
+ * Returns whether (`re`, `im`) lies inside the main cardioid, the period-2
+ * bulb or one of the active disks of `cache`. Points outside of the set that
+ * are closer to the boundary of the cardioid or the bulb than the rounding
+ * error of doubles need far more than UINT16_MAX iterations to escape, so the
+ * test is safe for all views.
+ *
+ * @param[in] cache InteriorCache object to check
+ * @param[in] re real part of position
+ * @param[in] im imaginary part of position
+ *
+ * @return true if (`re`, `im`) is known to be interior, false otherwise
+ */
+bool
+InteriorCache_contains(const InteriorCache *cache, double re, double im);
+
+#endif /* MANDELBROT_DATA_INTERIOR_H_INCLUDED */
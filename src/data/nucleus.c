@@ -0,0 +1,301 @@
+#include <data/nucleus.h>
+
+#include <cutil/std/stdbool.h>
+#include <cutil/util/macro.h>
+
+#include <util/floatexp.h>
+
+/**
+ * Number of bits by which Newton's method refines the nucleus beyond the
+ * radius of the search disk
+ */
+#define NUCLEUS_TOLERANCE_BITS 48UL
+
+/**
+ * Number of bits by which the tolerance of Newton's method has to exceed the
+ * resolution of the precision
+ */
+#define NUCLEUS_GUARD_BITS 16L
+
+/**
+ * Maximum number of Newton steps
+ */
+#define NUCLEUS_MAX_NEWTON_STEPS 64
+
+/**
+ * Absolute square beyond which the orbit escapes
+ */
+#define NUCLEUS_ESCAPE_SQR 4.0
+
+void
+Nucleus_init(Nucleus *nucleus)
+{
+    mpf_init(nucleus->re);
+    mpf_init(nucleus->im);
+    mpf_init(nucleus->z_re);
+    mpf_init(nucleus->z_im);
+    mpf_init(nucleus->dz_re);
+    mpf_init(nucleus->dz_im);
+    mpf_init(nucleus->re_sqr);
+    mpf_init(nucleus->im_sqr);
+    mpf_init(nucleus->tmp);
+    mpf_init(nucleus->tol);
+
+    nucleus->period = 0;
+}
+
+void
+Nucleus_clear(Nucleus *nucleus)
+{
+    mpf_clear(nucleus->re);
+    mpf_clear(nucleus->im);
+    mpf_clear(nucleus->z_re);
+    mpf_clear(nucleus->z_im);
+    mpf_clear(nucleus->dz_re);
+    mpf_clear(nucleus->dz_im);
+    mpf_clear(nucleus->re_sqr);
+    mpf_clear(nucleus->im_sqr);
+    mpf_clear(nucleus->tmp);
+    mpf_clear(nucleus->tol);
+}
+
+void
+Nucleus_set_prec(Nucleus *nucleus, mp_bitcnt_t prec)
+{
+    mpf_set_prec(nucleus->re, prec);
+    mpf_set_prec(nucleus->im, prec);
+    mpf_set_prec(nucleus->z_re, prec);
+    mpf_set_prec(nucleus->z_im, prec);
+    mpf_set_prec(nucleus->dz_re, prec);
+    mpf_set_prec(nucleus->dz_im, prec);
+    mpf_set_prec(nucleus->re_sqr, prec);
+    mpf_set_prec(nucleus->im_sqr, prec);
+    mpf_set_prec(nucleus->tmp, prec);
+    mpf_set_prec(nucleus->tol, prec);
+}
+
+/**
+ * Returns whether the non-negative FloatExp `lhs` is less than the non-negative
+ * FloatExp `rhs`.
+ */
+static bool
+_floatExp_is_less(FloatExp lhs, FloatExp rhs)
+{
+    if (rhs.mant == 0.0) {
+        return false;
+    }
+    if (lhs.mant == 0.0) {
+        return true;
+    }
+    if (lhs.exp != rhs.exp) {
+        return (lhs.exp < rhs.exp);
+    }
+    return (lhs.mant < rhs.mant);
+}
+
+/**
+ * Returns the absolute square of (`re`, `im`).
+ */
+static FloatExp
+_floatExp_abs_sqr(FloatExp re, FloatExp im)
+{
+    return FloatExp_add(FloatExp_mul(re, re), FloatExp_mul(im, im));
+}
+
+/**
+ * Performs one iteration z -> z^2 + c on the orbit buffer of `nucleus` for
+ * c = (`re`, `im`).
+ */
+static void
+_nucleus_iterate_z(Nucleus *nucleus, mpf_srcptr re, mpf_srcptr im)
+{
+    mpf_mul(nucleus->re_sqr, nucleus->z_re, nucleus->z_re);
+    mpf_mul(nucleus->im_sqr, nucleus->z_im, nucleus->z_im);
+
+    mpf_mul_ui(nucleus->z_im, nucleus->z_im, 2UL);
+    mpf_mul(nucleus->z_im, nucleus->z_im, nucleus->z_re);
+    mpf_add(nucleus->z_im, nucleus->z_im, im);
+
+    mpf_sub(nucleus->z_re, nucleus->re_sqr, nucleus->im_sqr);
+    mpf_add(nucleus->z_re, nucleus->z_re, re);
+}
+
+int
+Nucleus_find_period(
+  Nucleus *nucleus, mpf_srcptr re, mpf_srcptr im, mpf_srcptr radius,
+  int max_period
+)
+{
+    const FloatExp r = FloatExp_from_mpf(radius);
+    const FloatExp r_sqr = FloatExp_mul(r, r);
+    const FloatExp one = FloatExp_from_double(1.0);
+
+    /* Derivative w.r.t. c may leave the range of double at deep zooms */
+    FloatExp dz_re = FloatExp_from_double(0.0);
+    FloatExp dz_im = FloatExp_from_double(0.0);
+
+    mpf_set_ui(nucleus->z_re, 0UL);
+    mpf_set_ui(nucleus->z_im, 0UL);
+
+    for (int period = 1; period <= max_period; ++period) {
+        /* dz_{n+1} = 2 z_n dz_n + 1 */
+        const double z2_re = 2.0 * mpf_get_d(nucleus->z_re);
+        const double z2_im = 2.0 * mpf_get_d(nucleus->z_im);
+        const FloatExp tmp_re = FloatExp_add(
+          FloatExp_sub(
+            FloatExp_mul_d(dz_re, z2_re), FloatExp_mul_d(dz_im, z2_im)
+          ),
+          one
+        );
+        dz_im = FloatExp_add(
+          FloatExp_mul_d(dz_im, z2_re), FloatExp_mul_d(dz_re, z2_im)
+        );
+        dz_re = tmp_re;
+
+        _nucleus_iterate_z(nucleus, re, im);
+
+        const FloatExp z_re = FloatExp_from_mpf(nucleus->z_re);
+        const FloatExp z_im = FloatExp_from_mpf(nucleus->z_im);
+        const FloatExp z_sqr = _floatExp_abs_sqr(z_re, z_im);
+        if (FloatExp_to_double(z_sqr) > NUCLEUS_ESCAPE_SQR) {
+            return 0;
+        }
+
+        /* Image of disk is approximately disk of radius |dz| r around z */
+        const FloatExp dz_sqr = _floatExp_abs_sqr(dz_re, dz_im);
+        if (_floatExp_is_less(z_sqr, FloatExp_mul(dz_sqr, r_sqr))) {
+            return period;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Performs one Newton step for the nucleus of period `period` at the position
+ * of `nucleus`. The step is written to the orbit buffer. Returns false if the
+ * derivative vanishes.
+ */
+static bool
+_nucleus_newton_step(Nucleus *nucleus, int period)
+{
+    const mpf_ptr z_re = nucleus->z_re;
+    const mpf_ptr z_im = nucleus->z_im;
+    const mpf_ptr dz_re = nucleus->dz_re;
+    const mpf_ptr dz_im = nucleus->dz_im;
+    const mpf_ptr re_sqr = nucleus->re_sqr;
+    const mpf_ptr im_sqr = nucleus->im_sqr;
+    const mpf_ptr tmp = nucleus->tmp;
+
+    mpf_set_ui(z_re, 0UL);
+    mpf_set_ui(z_im, 0UL);
+    mpf_set_ui(dz_re, 0UL);
+    mpf_set_ui(dz_im, 0UL);
+
+    for (int itrs = 0; itrs < period; ++itrs) {
+        /* dz_{n+1} = 2 z_n dz_n + 1 */
+        mpf_mul(re_sqr, z_re, dz_re);
+        mpf_mul(im_sqr, z_im, dz_im);
+        mpf_sub(re_sqr, re_sqr, im_sqr);
+        mpf_mul(tmp, z_re, dz_im);
+        mpf_mul(im_sqr, z_im, dz_re);
+        mpf_add(tmp, tmp, im_sqr);
+        mpf_mul_2exp(dz_im, tmp, 1UL);
+        mpf_mul_2exp(dz_re, re_sqr, 1UL);
+        mpf_add_ui(dz_re, dz_re, 1UL);
+
+        _nucleus_iterate_z(nucleus, nucleus->re, nucleus->im);
+    }
+
+    /* Step is z / dz */
+    mpf_mul(re_sqr, dz_re, dz_re);
+    mpf_mul(im_sqr, dz_im, dz_im);
+    mpf_add(tmp, re_sqr, im_sqr);
+    if (mpf_sgn(tmp) == 0) {
+        return false;
+    }
+
+    mpf_mul(re_sqr, z_re, dz_re);
+    mpf_mul(im_sqr, z_im, dz_im);
+    mpf_add(re_sqr, re_sqr, im_sqr);
+
+    mpf_mul(z_im, z_im, dz_re);
+    mpf_mul(im_sqr, z_re, dz_im);
+    mpf_sub(z_im, z_im, im_sqr);
+
+    mpf_div(z_re, re_sqr, tmp);
+    mpf_div(z_im, z_im, tmp);
+    return true;
+}
+
+bool
+Nucleus_refine(
+  Nucleus *nucleus, mpf_srcptr re, mpf_srcptr im, int period, mpf_srcptr tol,
+  int max_steps
+)
+{
+    mpf_set(nucleus->re, re);
+    mpf_set(nucleus->im, im);
+
+    for (int step = 0; step < max_steps; ++step) {
+        if (!_nucleus_newton_step(nucleus, period)) {
+            return false;
+        }
+
+        mpf_sub(nucleus->re, nucleus->re, nucleus->z_re);
+        mpf_sub(nucleus->im, nucleus->im, nucleus->z_im);
+
+        /* Maximum norm is good enough for the stopping criterion */
+        mpf_abs(nucleus->z_re, nucleus->z_re);
+        mpf_abs(nucleus->z_im, nucleus->z_im);
+        if (mpf_cmp(nucleus->z_re, tol) < 0
+            && mpf_cmp(nucleus->z_im, tol) < 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool
+Nucleus_find(
+  Nucleus *nucleus, mpf_srcptr re, mpf_srcptr im, mpf_srcptr radius,
+  int max_period
+)
+{
+    const int period = Nucleus_find_period(nucleus, re, im, radius, max_period);
+    nucleus->period = 0;
+    if (period == 0) {
+        return false;
+    }
+
+    mpf_div_2exp(nucleus->tol, radius, NUCLEUS_TOLERANCE_BITS);
+
+    /* Newton's method cannot resolve the nucleus beyond the precision */
+    long int exp_re = 0;
+    long int exp_im = 0;
+    CUTIL_UNUSED(mpf_get_d_2exp(&exp_re, re));
+    CUTIL_UNUSED(mpf_get_d_2exp(&exp_im, im));
+    const long int exp = (exp_re > exp_im) ? exp_re : exp_im;
+    const long int prec = (long int) mpf_get_prec(nucleus->re);
+    const long int exp_min = exp - prec + NUCLEUS_GUARD_BITS;
+    mpf_set_ui(nucleus->tmp, 1UL);
+    if (exp_min >= 0) {
+        mpf_mul_2exp(nucleus->tmp, nucleus->tmp, exp_min);
+    } else {
+        mpf_div_2exp(nucleus->tmp, nucleus->tmp, -exp_min);
+    }
+    if (mpf_cmp(nucleus->tol, nucleus->tmp) < 0) {
+        mpf_set(nucleus->tol, nucleus->tmp);
+    }
+    if (!Nucleus_refine(
+          nucleus, re, im, period, nucleus->tol, NUCLEUS_MAX_NEWTON_STEPS
+        ))
+    {
+        return false;
+    }
+
+    nucleus->period = period;
+    return true;
+}
@@ -0,0 +1,119 @@
+/* data/nucleus.h
+ *
+ * Header for nuclei of hyperbolic components (minibrots)
+ *
+ */
+
+#ifndef MANDELBROT_DATA_NUCLEUS_H_INCLUDED
+#define MANDELBROT_DATA_NUCLEUS_H_INCLUDED
+
+#include <gmp.h>
+
+#include <cutil/std/stdbool.h>
+
+/**
+ * Struct for the nucleus of a hyperbolic component of the Mandelbrot set, i.e.,
+ * a point whose orbit returns to 0 after `period` iterations. Its orbit never
+ * escapes, which makes it a good reference point for perturbation.
+ */
+typedef struct {
+    mpf_t re;     /* Real part of nucleus */
+    mpf_t im;     /* Imaginary part of nucleus */
+    int period;   /* Period of nucleus (0 if none was found) */
+    mpf_t z_re;   /* Buffer for real part of orbit */
+    mpf_t z_im;   /* Buffer for imaginary part of orbit */
+    mpf_t dz_re;  /* Buffer for real part of derivative */
+    mpf_t dz_im;  /* Buffer for imaginary part of derivative */
+    mpf_t re_sqr; /* Buffer for square of real part */
+    mpf_t im_sqr; /* Buffer for square of imaginary part */
+    mpf_t tmp;    /* Temporary buffer */
+    mpf_t tol;    /* Tolerance for Newton's method */
+} Nucleus;
+
+/**
+ * Initializes fields in `nucleus`.
+ *
+ * @param[in] nucleus Nucleus object to initialize
+ */
+void
+Nucleus_init(Nucleus *nucleus);
+
+/**
+ * Clears fields in `nucleus`.
+ *
+ * @param[in] nucleus Nucleus object to clear
+ */
+void
+Nucleus_clear(Nucleus *nucleus);
+
+/**
+ * Sets precision of mpf fields in `nucleus` to `prec`.
+ *
+ * @param[in] nucleus Nucleus object to set precision of
+ * @param[in] prec precision to set to
+ */
+void
+Nucleus_set_prec(Nucleus *nucleus, mp_bitcnt_t prec);
+
+/**
+ * Returns the period of the lowest-period component that intersects the disk
+ * of radius `radius` around (`re`, `im`), i.e., the first iteration at which
+ * the (linearly approximated) image of the disk contains 0. Returns 0 if there
+ * is no such period up to `max_period` or if the centre escapes before.
+ *
+ * @param[in] nucleus Nucleus object to use buffers of
+ * @param[in] re real part of centre of disk
+ * @param[in] im imaginary part of centre of disk
+ * @param[in] radius radius of disk
+ * @param[in] max_period maximum period to check
+ *
+ * @return period of lowest-period component, 0 if none was found
+ */
+int
+Nucleus_find_period(
+  Nucleus *nucleus, mpf_srcptr re, mpf_srcptr im, mpf_srcptr radius,
+  int max_period
+);
+
+/**
+ * Refines the nucleus of period `period` by Newton's method starting at
+ * (`re`, `im`) until the Newton step falls below `tol` in absolute value, but
+ * for at most `max_steps` steps. The result is written to the position of
+ * `nucleus`. Returns whether Newton's method converged.
+ *
+ * @param[in] nucleus Nucleus object to write result to
+ * @param[in] re real part of starting point
+ * @param[in] im imaginary part of starting point
+ * @param[in] period period of nucleus
+ * @param[in] tol tolerance for Newton step
+ * @param[in] max_steps maximum number of Newton steps
+ *
+ * @return true if Newton's method converged, false otherwise
+ */
+bool
+Nucleus_refine(
+  Nucleus *nucleus, mpf_srcptr re, mpf_srcptr im, int period, mpf_srcptr tol,
+  int max_steps
+);
+
+/**
+ * Finds the nucleus of the lowest-period component near (`re`, `im`) by
+ * `Nucleus_find_period` with radius `radius` and `Nucleus_refine`. Returns
+ * whether a nucleus was found, in which case its position and period are
+ * written to `nucleus`. The nucleus is not guaranteed to lie inside the disk.
+ *
+ * @param[in] nucleus Nucleus object to write result to
+ * @param[in] re real part of centre of disk
+ * @param[in] im imaginary part of centre of disk
+ * @param[in] radius radius of disk
+ * @param[in] max_period maximum period to check
+ *
+ * @return true if a nucleus was found, false otherwise
+ */
+bool
+Nucleus_find(
+  Nucleus *nucleus, mpf_srcptr re, mpf_srcptr im, mpf_srcptr radius,
+  int max_period
+);
+
+#endif /* MANDELBROT_DATA_NUCLEUS_H_INCLUDED */
@@ -0,0 +1,244 @@
+#include <data/orbit.h>
+
+#include <cutil/std/math.h>
+#include <cutil/std/stdbool.h>
+#include <cutil/std/stdlib.h>
+
+void
+ReferenceOrbit_init(ReferenceOrbit *orbit)
+{
+    mpf_init(orbit->re);
+    mpf_init(orbit->im);
+    mpf_init(orbit->z_re);
+    mpf_init(orbit->z_im);
+    mpf_init(orbit->re_sqr);
+    mpf_init(orbit->im_sqr);
+
+    orbit->len = 0;
+    orbit->cap = 0;
+    orbit->orbit_re = NULL;
+    orbit->orbit_im = NULL;
+    orbit->series_len = 0;
+    orbit->series = NULL;
+}
+
+void
+ReferenceOrbit_clear(ReferenceOrbit *orbit)
+{
+    mpf_clear(orbit->re);
+    mpf_clear(orbit->im);
+    mpf_clear(orbit->z_re);
+    mpf_clear(orbit->z_im);
+    mpf_clear(orbit->re_sqr);
+    mpf_clear(orbit->im_sqr);
+
+    free(orbit->orbit_re);
+    free(orbit->orbit_im);
+    free(orbit->series);
+}
+
+void
+ReferenceOrbit_set_prec(ReferenceOrbit *orbit, mp_bitcnt_t prec)
+{
+    mpf_set_prec(orbit->re, prec);
+    mpf_set_prec(orbit->im, prec);
+    mpf_set_prec(orbit->z_re, prec);
+    mpf_set_prec(orbit->z_im, prec);
+    mpf_set_prec(orbit->re_sqr, prec);
+    mpf_set_prec(orbit->im_sqr, prec);
+}
+
+static void
+_referenceOrbit_reserve(ReferenceOrbit *orbit, int cap)
+{
+    if (cap <= orbit->cap) {
+        return;
+    }
+    orbit->cap = cap;
+    orbit->orbit_re = realloc(orbit->orbit_re, cap * sizeof *orbit->orbit_re);
+    orbit->orbit_im = realloc(orbit->orbit_im, cap * sizeof *orbit->orbit_im);
+    orbit->series = realloc(orbit->series, cap * sizeof *orbit->series);
+}
+
+static bool
+_seriesCoefficients_is_finite(const SeriesCoefficients *coeffs)
+{
+    return isfinite(coeffs->a_re) && isfinite(coeffs->a_im)
+           && isfinite(coeffs->b_re) && isfinite(coeffs->b_im)
+           && isfinite(coeffs->c_re) && isfinite(coeffs->c_im);
+}
+
+/**
+ * Computes the series coefficients of `orbit` for all stored orbit points
+ * until they are no longer finite:
+ *   A_{n+1} = 2 Z_n A_n + 1
+ *   B_{n+1} = 2 Z_n B_n + A_n^2
+ *   C_{n+1} = 2 Z_n C_n + 2 A_n B_n
+ */
+static void
+_referenceOrbit_compute_series(ReferenceOrbit *orbit)
+{
+    SeriesCoefficients *const series = orbit->series;
+    series[0] = (SeriesCoefficients){0};
+    orbit->series_len = 1;
+
+    for (int itrs = 1; itrs < orbit->len; ++itrs) {
+        const SeriesCoefficients *const old = &series[itrs - 1];
+        SeriesCoefficients *const new = &series[itrs];
+
+        const double z2_re = 2.0 * orbit->orbit_re[itrs - 1];
+        const double z2_im = 2.0 * orbit->orbit_im[itrs - 1];
+
+        new->a_re = z2_re * old->a_re - z2_im * old->a_im + 1.0;
+        new->a_im = z2_re * old->a_im + z2_im * old->a_re;
+
+        new->b_re = z2_re * old->b_re - z2_im * old->b_im
+                    + old->a_re * old->a_re - old->a_im * old->a_im;
+        new->b_im = z2_re * old->b_im + z2_im * old->b_re
+                    + 2.0 * old->a_re * old->a_im;
+
+        new->c_re = z2_re * old->c_re - z2_im * old->c_im
+                    + 2.0 * (old->a_re * old->b_re - old->a_im * old->b_im);
+        new->c_im = z2_re * old->c_im + z2_im * old->c_re
+                    + 2.0 * (old->a_re * old->b_im + old->a_im * old->b_re);
+
+        if (!_seriesCoefficients_is_finite(new)) {
+            return;
+        }
+        orbit->series_len = itrs + 1;
+    }
+}
+
+void
+ReferenceOrbit_compute(
+  ReferenceOrbit *orbit, mpf_srcptr re, mpf_srcptr im, double max_sqr,
+  uint16_t max_itrs
+)
+{
+    _referenceOrbit_reserve(orbit, max_itrs + 1);
+
+    mpf_set(orbit->re, re);
+    mpf_set(orbit->im, im);
+
+    mpf_set_ui(orbit->z_re, 0UL);
+    mpf_set_ui(orbit->z_im, 0UL);
+    orbit->orbit_re[0] = 0.0;
+    orbit->orbit_im[0] = 0.0;
+    orbit->len = 1;
+
+    for (int itrs = 1; itrs <= max_itrs; ++itrs) {
+        mpf_mul(orbit->re_sqr, orbit->z_re, orbit->z_re);
+        mpf_mul(orbit->im_sqr, orbit->z_im, orbit->z_im);
+
+        const double abs_sqr
+          = mpf_get_d(orbit->re_sqr) + mpf_get_d(orbit->im_sqr);
+        if (abs_sqr > max_sqr) {
+            break;
+        }
+
+        mpf_mul_ui(orbit->z_im, orbit->z_im, 2UL);
+        mpf_mul(orbit->z_im, orbit->z_im, orbit->z_re);
+        mpf_add(orbit->z_im, orbit->z_im, orbit->im);
+
+        mpf_sub(orbit->z_re, orbit->re_sqr, orbit->im_sqr);
+        mpf_add(orbit->z_re, orbit->z_re, orbit->re);
+
+        orbit->orbit_re[itrs] = mpf_get_d(orbit->z_re);
+        orbit->orbit_im[itrs] = mpf_get_d(orbit->z_im);
+        orbit->len = itrs + 1;
+    }
+
+    _referenceOrbit_compute_series(orbit);
+}
+
+void
+ReferenceOrbit_approximate(
+  const ReferenceOrbit *orbit, int itrs, double dc_re, double dc_im,
+  double *d_re, double *d_im
+)
+{
+    const SeriesCoefficients *const coeffs = &orbit->series[itrs];
+
+    /* Horner scheme to avoid underflow of powers of dc */
+    double re = coeffs->c_re * dc_re - coeffs->c_im * dc_im + coeffs->b_re;
+    double im = coeffs->c_re * dc_im + coeffs->c_im * dc_re + coeffs->b_im;
+
+    double tmp = re * dc_re - im * dc_im + coeffs->a_re;
+    im = re * dc_im + im * dc_re + coeffs->a_im;
+    re = tmp;
+
+    *d_re = re * dc_re - im * dc_im;
+    *d_im = re * dc_im + im * dc_re;
+}
+
+/**
+ * Returns the number of iterations that can be skipped for the single probe
+ * point with difference (`dc_re`, `dc_im`) to the reference point.
+ */
+static int
+_referenceOrbit_get_skip_probe(
+  const ReferenceOrbit *orbit, double dc_re, double dc_im, double max_abs,
+  double tol
+)
+{
+    const double tol_sqr = tol * tol;
+    const double *const orbit_re = orbit->orbit_re;
+    const double *const orbit_im = orbit->orbit_im;
+
+    double d_re = 0.0;
+    double d_im = 0.0;
+
+    int itrs;
+    for (itrs = 1; itrs < orbit->series_len; ++itrs) {
+        const double ref_re = orbit_re[itrs - 1];
+        const double ref_im = orbit_im[itrs - 1];
+
+        /* The points between the probes may deviate more from the orbit */
+        const double ref_abs = sqrt(ref_re * ref_re + ref_im * ref_im);
+        const double d_abs = sqrt(d_re * d_re + d_im * d_im);
+        if (ref_abs + 2.0 * d_abs > max_abs) {
+            break;
+        }
+
+        const double sum_re = 2.0 * ref_re + d_re;
+        const double sum_im = 2.0 * ref_im + d_im;
+        const double tmp_re = sum_re * d_re - sum_im * d_im + dc_re;
+        d_im = sum_re * d_im + sum_im * d_re + dc_im;
+        d_re = tmp_re;
+
+        double s_re, s_im;
+        ReferenceOrbit_approximate(orbit, itrs, dc_re, dc_im, &s_re, &s_im);
+
+        const double err_re = s_re - d_re;
+        const double err_im = s_im - d_im;
+        const double err_sqr = err_re * err_re + err_im * err_im;
+        const double d_sqr = d_re * d_re + d_im * d_im;
+        if (!(err_sqr <= tol_sqr * d_sqr)) {
+            break;
+        }
+    }
+
+    return itrs - 1;
+}
+
+int
+ReferenceOrbit_get_skip(
+  const ReferenceOrbit *orbit, const double *dc_re, const double *dc_im,
+  int num, double max_sqr, double tol
+)
+{
+    const double max_abs = sqrt(max_sqr);
+
+    int skip = orbit->series_len - 1;
+    for (int i = 0; i < num; ++i) {
+        const int skip_probe
+          = _referenceOrbit_get_skip_probe(
+            orbit, dc_re[i], dc_im[i], max_abs, tol
+          );
+        if (skip_probe < skip) {
+            skip = skip_probe;
+        }
+    }
+
+    return (skip > 0) ? skip : 0;
+}
@@ -0,0 +1,132 @@
+/* data/orbit.h
+ *
+ * Header for reference orbits (for perturbation)
+ *
+ */
+
+#ifndef MANDELBROT_DATA_ORBIT_H_INCLUDED
+#define MANDELBROT_DATA_ORBIT_H_INCLUDED
+
+#include <inttypes.h>
+
+#include <gmp.h>
+
+/**
+ * Struct for the coefficients of the series approximation of the difference
+ * to a reference orbit, i.e., d_n = A_n dc + B_n dc^2 + C_n dc^3
+ */
+typedef struct {
+    double a_re;
+    double a_im;
+    double b_re;
+    double b_im;
+    double c_re;
+    double c_im;
+} SeriesCoefficients;
+
+/**
+ * Struct for a reference orbit that is computed in full precision and stored
+ * in doubles. Pixels close to the reference point only have to iterate their
+ * (small) difference to this orbit.
+ */
+typedef struct {
+    mpf_t re;                   /* Real part of reference point */
+    mpf_t im;                   /* Imaginary part of reference point */
+    mpf_t z_re;                 /* Buffer for real part of orbit */
+    mpf_t z_im;                 /* Buffer for imaginary part of orbit */
+    mpf_t re_sqr;               /* Buffer for square of real part */
+    mpf_t im_sqr;               /* Buffer for square of imaginary part */
+    int len;                    /* Number of stored orbit points */
+    int cap;                    /* Capacity of `orbit_re` and `orbit_im` */
+    double *orbit_re;           /* Real parts of orbit points */
+    double *orbit_im;           /* Imaginary parts of orbit points */
+    int series_len;             /* Number of stored series coefficients */
+    SeriesCoefficients *series; /* Series coefficients for each orbit point */
+} ReferenceOrbit;
+
+/**
+ * Initializes fields in `orbit`.
+ *
+ * @param[in] orbit ReferenceOrbit object to initialize
+ */
+void
+ReferenceOrbit_init(ReferenceOrbit *orbit);
+
+/**
+ * Clears fields in `orbit`.
+ *
+ * @param[in] orbit ReferenceOrbit object to clear
+ */
+void
+ReferenceOrbit_clear(ReferenceOrbit *orbit);
+
+/**
+ * Sets precision of mpf fields in `orbit` to `prec`.
+ *
+ * @param[in] orbit ReferenceOrbit object to set precision of
+ * @param[in] prec precision to set to
+ */
+void
+ReferenceOrbit_set_prec(ReferenceOrbit *orbit, mp_bitcnt_t prec);
+
+/**
+ * Computes orbit of reference point (`re`, `im`) in full precision up to at
+ * most `max_itrs` iterations or until the absolute square of an orbit point
+ * exceeds `max_sqr`. This last orbit point is still stored. Also computes the
+ * coefficients of the series approximation for as long as they are finite.
+ *
+ * @param[in] orbit ReferenceOrbit object to compute orbit of
+ * @param[in] re real part of reference point
+ * @param[in] im imaginary part of reference point
+ * @param[in] max_sqr maximum absolute square for iteration
+ * @param[in] max_itrs maximum number of iterations to perform
+ */
+void
+ReferenceOrbit_compute(
+  ReferenceOrbit *orbit, mpf_srcptr re, mpf_srcptr im, double max_sqr,
+  uint16_t max_itrs
+);
+
+/**
+ * Approximates the difference to the `itrs`-th point of `orbit` for a point
+ * with difference (`dc_re`, `dc_im`) to the reference point by the series
+ * approximation. `itrs` must be smaller than `orbit->series_len`.
+ *
+ * @param[in] orbit ReferenceOrbit object to use series coefficients of
+ * @param[in] itrs index of orbit point
+ * @param[in] dc_re real part of difference to reference point
+ * @param[in] dc_im imaginary part of difference to reference point
+ * @param[out] d_re real part of approximated difference to orbit point
+ * @param[out] d_im imaginary part of approximated difference to orbit point
+ */
+void
+ReferenceOrbit_approximate(
+  const ReferenceOrbit *orbit, int itrs, double dc_re, double dc_im,
+  double *d_re, double *d_im
+);
+
+/**
+ * Returns the number of iterations that can be skipped by the series
+ * approximation for all points inside the region spanned by the `num` probe
+ * points with differences (`dc_re[i]`, `dc_im[i]`) to the reference point,
+ * e.g., the corners of a chunk. For each probe point, the series approximation
+ * is compared against the directly perturbed orbit and the iterations are only
+ * skipped as long as their relative difference stays within `tol` and no
+ * point could have escaped yet.
+ *
+ * @param[in] orbit ReferenceOrbit object to use series coefficients of
+ * @param[in] dc_re real parts of differences of probe points
+ * @param[in] dc_im imaginary parts of differences of probe points
+ * @param[in] num number of probe points
+ * @param[in] max_sqr maximum absolute square for iteration
+ * @param[in] tol maximum relative difference of the series approximation
+ *
+ * @return number of iterations that can be skipped
+ */
+int
+ReferenceOrbit_get_skip(
+  const ReferenceOrbit *orbit, const double *dc_re, const double *dc_im,
+  int num, double max_sqr, double tol
+);
+
+#endif /* MANDELBROT_DATA_ORBIT_H_INCLUDED */
@@ -1,20 +1,148 @@
 #include <data/pixel.h>
 
+#include <float.h>
+#include <limits.h>
+
+#include <cutil/std/math.h>
+#include <cutil/std/stdbool.h>
+#include <cutil/util/macro.h>
+
+#include <util/cpu.h>
 #include <visuals/palette.h>
 
-#define PERIODICITY_CHECK_CYCLE_LENGTH 25
-#define MPF_SIMILARITY_THRESHOLD 1.0e-6
+#if CPU_HAVE_AVX2 || CPU_HAVE_AVX512
+    #include <immintrin.h>
+#endif
+
+/* Number of lanes of the vectorized double-precision kernels */
+#define AVX512_LANES 8
+#define AVX2_LANES 4
+#define PIXEL_SEGMENT_MAX_LANES AVX512_LANES
+
+/**
+ * Brent-style cycle detection: the orbit point is saved at checkpoints and
+ * compared to all subsequent ones. The distance of consecutive checkpoints is
+ * the fraction 2^-PERIODICITY_INTERVAL_SHIFT of the iteration count, so cycles
+ * of any period are found eventually, while short cycles are still detected
+ * soon after the orbit has converged (unlike with checkpoints at powers of
+ * two, which may double the iterations of interior points).
+ */
+#define PERIODICITY_INTERVAL_SHIFT 3
+
+/**
+ * Binary digits by which the absolute tolerance of the cycle detection lies
+ * below the distance of pixels, but at least above the rounding errors of the
+ * working precision
+ */
+#define PERIODICITY_TOLERANCE_BITS 10
+#define PERIODICITY_GUARD_BITS 16
+
+/**
+ * The orbit is considered to contract onto an attracting cycle once the
+ * absolute square of its derivative with respect to its first point is below
+ * DERIVATIVE_INTERIOR_THRESHOLD and has shrunk by DERIVATIVE_DECAY since the
+ * last checkpoint. The latter rejects orbits that merely linger close to a
+ * (nearly) parabolic point, where the derivative stagnates.
+ */
+#define DERIVATIVE_INTERIOR_THRESHOLD 1.0e-6
+#define DERIVATIVE_DECAY 0.5
+
+/* Exponent above which FloatExp differences are continued as doubles */
+#define FLOATEXP_HANDOFF_EXP (DBL_MIN_EXP + 128)
+
+/**
+ * Relative absolute square below which a perturbed orbit point is considered
+ * glitched, i.e., |Z_n + d_n|^2 < GLITCH_TOLERANCE |Z_n|^2 (Pauldelbrot's
+ * criterion)
+ */
+#define GLITCH_TOLERANCE 1.0e-6
+
+/**
+ * Returns the checkpoint of the cycle detection following the one at `itrs`.
+ */
+static inline int
+_periodicity_next_checkpoint(int itrs)
+{
+    const int interval = itrs >> PERIODICITY_INTERVAL_SHIFT;
+    return itrs + ((interval > 0) ? interval : 1);
+}
 
+/**
+ * Returns whether |`lhs` - `rhs`| < 2^`tol_exp`. Only the exponent of the
+ * difference is inspected, i.e., merely its top limbs are read.
+ */
 static inline int
-_mpf_is_similar(mpf_srcptr lhs, mpf_srcptr rhs, mpf_ptr tmp, double reldiff)
+_mpf_is_close(mpf_srcptr lhs, mpf_srcptr rhs, mpf_ptr tmp, long int tol_exp)
+{
+    mpf_sub(tmp, lhs, rhs);
+    if (mpf_sgn(tmp) == 0) {
+        return true;
+    }
+    long int exp = 0;
+    CUTIL_UNUSED(mpf_get_d_2exp(&exp, tmp));
+    return (exp <= tol_exp);
+}
+
+/**
+ * Struct for the derivative of an orbit with respect to its first point, which
+ * is tracked in doubles alongside the orbit
+ */
+typedef struct {
+    double re;
+    double im;
+    double sqr_old; /* Absolute square at the previous checkpoint */
+} OrbitDerivative;
+
+static inline void
+_orbitDerivative_init(OrbitDerivative *dz)
 {
-    mpf_reldiff(tmp, lhs, rhs);
-    mpf_abs(tmp, tmp);
-    return (mpf_cmp_d(tmp, reldiff) < 0);
+    dz->re = 1.0;
+    dz->im = 0.0;
+    dz->sqr_old = 1.0;
 }
 
-#define MPF_IS_SIMILAR(lhs, rhs, tmp)                                          \
-    _mpf_is_similar((lhs), (rhs), (tmp), MPF_SIMILARITY_THRESHOLD)
+/**
+ * Advances `dz` by one iteration at orbit point (`z_re`, `z_im`), i.e.,
+ * multiplies it by 2 (`z_re`, `z_im`).
+ */
+static inline void
+_orbitDerivative_update(OrbitDerivative *dz, double z_re, double z_im)
+{
+    const double tmp_re = 2.0 * (z_re * dz->re - z_im * dz->im);
+    dz->im = 2.0 * (z_re * dz->im + z_im * dz->re);
+    dz->re = tmp_re;
+}
+
+/**
+ * Returns whether the orbit of `dz` contracts onto an attracting cycle. Has to
+ * be called at the checkpoints of the cycle detection.
+ */
+static inline bool
+_orbitDerivative_is_contracting(OrbitDerivative *dz)
+{
+    const double sqr = dz->re * dz->re + dz->im * dz->im;
+    const bool is_contracting = (sqr < DERIVATIVE_INTERIOR_THRESHOLD)
+                                && (sqr < DERIVATIVE_DECAY * dz->sqr_old);
+    dz->sqr_old = sqr;
+    return is_contracting;
+}
+
+/**
+ * Returns whether |`lhs` - `rhs`| < `tol`.
+ */
+static inline int
+_double_is_close(double lhs, double rhs, double tol)
+{
+    return (fabs(lhs - rhs) < tol);
+}
+
+double
+PixelData_get_tolerance(double upp)
+{
+    const double tol = ldexp(upp, -PERIODICITY_TOLERANCE_BITS);
+    const double min_tol = ldexp(1.0, PERIODICITY_GUARD_BITS - DBL_MANT_DIG);
+    return (tol > min_tol) ? tol : min_tol;
+}
 
 void
 PixelDataBuffer_init(PixelDataBuffer *buf, mpf_t max_sqr)
@@ -30,6 +158,10 @@ PixelDataBuffer_init(PixelDataBuffer *buf, mpf_t max_sqr)
     mpf_init(buf->tmp);
 
     mpf_set(buf->max_sqr, max_sqr);
+
+    /* Strictest sensible tolerance until the pixel distance is known */
+    const long int prec = (long int) mpf_get_prec(buf->re);
+    buf->tol_exp = PERIODICITY_GUARD_BITS - prec;
 }
 
 void
@@ -60,6 +192,18 @@ PixelDataBuffer_set_prec(PixelDataBuffer *buf, mp_bitcnt_t prec)
     mpf_set_prec(buf->tmp, prec);
 }
 
+void
+PixelDataBuffer_set_tolerance(PixelDataBuffer *buf, mpf_srcptr upp)
+{
+    long int exp_upp = 0;
+    CUTIL_UNUSED(mpf_get_d_2exp(&exp_upp, upp));
+    const long int prec = (long int) mpf_get_prec(buf->re);
+
+    const long int tol_exp = exp_upp - PERIODICITY_TOLERANCE_BITS;
+    const long int min_tol_exp = PERIODICITY_GUARD_BITS - prec;
+    buf->tol_exp = (tol_exp > min_tol_exp) ? tol_exp : min_tol_exp;
+}
+
 void
 PixelData_init(PixelData *px)
 {
@@ -67,6 +211,7 @@ PixelData_init(PixelData *px)
     mpf_init(px->im);
     px->state = PIXEL_STATE_INVALID;
     px->itrs = PALETTE_INVALID_POS;
+    px->flags = PIXEL_FLAG_NONE;
 }
 
 void
@@ -92,8 +237,20 @@ PixelData_iterate(PixelData *px, PixelDataBuffer *buf, uint16_t max_itrs)
     mpf_set_ui(buf->re_old, 0UL);
     mpf_set_ui(buf->im_old, 0UL);
 
-    uint16_t period = 0;
+    OrbitDerivative dz;
+    _orbitDerivative_init(&dz);
+
+    px->flags = PIXEL_FLAG_NONE;
+    const long int tol_exp = buf->tol_exp;
+    int checkpoint = 1;
     for (uint16_t itrs = 1; itrs <= max_itrs; ++itrs) {
+        /* The first orbit point is `px` itself */
+        if (itrs > 1) {
+            _orbitDerivative_update(
+              &dz, mpf_get_d(buf->re), mpf_get_d(buf->im)
+            );
+        }
+
         mpf_mul(buf->re_sqr, buf->re, buf->re);
         mpf_mul(buf->im_sqr, buf->im, buf->im);
 
@@ -110,16 +267,20 @@ PixelData_iterate(PixelData *px, PixelDataBuffer *buf, uint16_t max_itrs)
             return;
         }
 
-        if (MPF_IS_SIMILAR(buf->re, buf->re_old, buf->tmp)
-            && MPF_IS_SIMILAR(buf->im, buf->im_old, buf->tmp))
+        if (_mpf_is_close(buf->re, buf->re_old, buf->tmp, tol_exp)
+            && _mpf_is_close(buf->im, buf->im_old, buf->tmp, tol_exp))
         {
             px->itrs = 0.0F;
             return;
         }
 
-        ++period;
-        if (period > PERIODICITY_CHECK_CYCLE_LENGTH) {
-            period = 0;
+        if (itrs >= checkpoint) {
+            if (_orbitDerivative_is_contracting(&dz)) {
+                px->itrs = 0.0F;
+                px->flags = PIXEL_FLAG_DERIVATIVE;
+                return;
+            }
+            checkpoint = _periodicity_next_checkpoint(itrs);
             mpf_set(buf->re_old, buf->re);
             mpf_set(buf->im_old, buf->im);
         }
@@ -127,3 +288,1030 @@ PixelData_iterate(PixelData *px, PixelDataBuffer *buf, uint16_t max_itrs)
 
     px->itrs = 0.0F; /* Converged I guess.. */
 }
+
+/**
+ * Number of integer bits of the fixed-point numbers of the fixed-limb kernel.
+ * Orbit points are at most |z|^2 <= 4 before escaping and the parts of c are
+ * less than FIXED_MAX_POS, so the parts of the next point are less than 8 and
+ * |z|^2 < 2^7 holds for all intermediate results.
+ */
+#define FIXED_INT_BITS 8
+
+/* Number of fraction bits in the most significant limb */
+#define FIXED_TOP_FRAC_BITS (GMP_NUMB_BITS - FIXED_INT_BITS)
+
+/**
+ * Positions with larger absolute parts cannot be handled in fixed point, as
+ * their orbits may overflow FIXED_INT_BITS (these escape immediately anyway)
+ */
+#define FIXED_MAX_POS 4.0
+
+/**
+ * Sets `r` to |`x`| * 2^(`n` GMP_NUMB_BITS - FIXED_INT_BITS), truncated to `n`
+ * limbs, and returns whether `x` is negative. Requires |`x`| to be less than
+ * 2^FIXED_INT_BITS.
+ * Reads the limbs of `x` directly (see "Float Internals" in the GMP manual).
+ */
+static bool
+_fixed_from_mpf(mp_limb_t *r, mpf_srcptr x, mp_size_t n)
+{
+    mp_limb_t tmp[PIXEL_FIXED_MAX_LIMBS + 1] = {0};
+
+    /* Limb i of `x` has weight B^(exp - size + i); tmp[j] has B^(j - n) */
+    const mp_size_t size = (x->_mp_size < 0) ? -x->_mp_size : x->_mp_size;
+    const mp_size_t shift = x->_mp_exp - size + n;
+    for (mp_size_t i = 0; i < size; ++i) {
+        const mp_size_t j = i + shift;
+        if (j >= 0 && j <= n) {
+            tmp[j] = x->_mp_d[i];
+        }
+    }
+
+    CUTIL_UNUSED(mpn_rshift(tmp, tmp, n + 1, FIXED_INT_BITS));
+    mpn_copyi(r, tmp, n);
+    return (x->_mp_size < 0);
+}
+
+/**
+ * Sets `r` to the signed sum of `a` and `b` with `n` limbs and returns whether
+ * the result is negative. `r` may coincide with `a` or `b`.
+ */
+static inline bool
+_fixed_add(
+  mp_limb_t *r, const mp_limb_t *a, bool a_neg, const mp_limb_t *b,
+  bool b_neg, mp_size_t n
+)
+{
+    if (a_neg == b_neg) {
+        CUTIL_UNUSED(mpn_add_n(r, a, b, n));
+        return a_neg;
+    }
+    if (mpn_cmp(a, b, n) >= 0) {
+        CUTIL_UNUSED(mpn_sub_n(r, a, b, n));
+        return a_neg;
+    }
+    CUTIL_UNUSED(mpn_sub_n(r, b, a, n));
+    return b_neg;
+}
+
+/**
+ * Sets `r` to the fixed-point number of `n` limbs of the full product `prod` of
+ * 2 `n` limbs, multiplied by 2^(FIXED_INT_BITS - `shift`). `prod` is
+ * overwritten.
+ */
+static inline void
+_fixed_reduce_product(
+  mp_limb_t *r, mp_limb_t *prod, mp_size_t n, unsigned int shift
+)
+{
+    CUTIL_UNUSED(mpn_rshift(prod + n - 1, prod + n - 1, n + 1, shift));
+    mpn_copyi(r, prod + n - 1, n);
+}
+
+/**
+ * Returns the signed fixed-point number `x` of `n` limbs as double. Only the
+ * most significant limb is read, which is accurate enough for the derivative.
+ */
+static inline double
+_fixed_to_double(const mp_limb_t *x, bool x_neg, mp_size_t n)
+{
+    const double res = ldexp((double) x[n - 1], -FIXED_TOP_FRAC_BITS);
+    return x_neg ? -res : res;
+}
+
+/**
+ * Fixed-point version of `_mpf_is_close` for the signed numbers `lhs` and `rhs`
+ * of `n` limbs. Only the limbs of the difference above bit `tol_bit` (i.e., the
+ * bit of weight 2^tol_exp) are inspected. `tmp` has to hold `n` limbs.
+ */
+static inline int
+_fixed_is_close(
+  const mp_limb_t *lhs, bool lhs_neg, const mp_limb_t *rhs, bool rhs_neg,
+  mp_limb_t *tmp, mp_size_t n, long int tol_bit
+)
+{
+    CUTIL_UNUSED(_fixed_add(tmp, lhs, lhs_neg, rhs, !rhs_neg, n));
+    if (tol_bit <= 0) {
+        return mpn_zero_p(tmp, n);
+    }
+    const mp_size_t limb = tol_bit / GMP_NUMB_BITS;
+    if (limb >= n) {
+        return true;
+    }
+    const unsigned int bit = tol_bit % GMP_NUMB_BITS;
+    for (mp_size_t i = n - 1; i > limb; --i) {
+        if (tmp[i] != 0) {
+            return false;
+        }
+    }
+    return ((tmp[limb] >> bit) == 0);
+}
+
+/**
+ * Defines the fixed-limb iteration `_iterate_fixed_N` for `N` limbs, i.e.,
+ * with all buffers on the stack and all limb counts known at compile time.
+ * Returns the iteration at which the position (`c_re`, `c_im`) escaped or 0 if
+ * it (presumably) converged, in which case `*is_derivative` tells whether this
+ * was detected by the derivative only.
+ */
+#define FIXED_ITERATE_DEFINE(N)                                                \
+    static uint16_t _iterate_fixed_##N(                                        \
+      const mp_limb_t *c_re, bool c_re_neg, const mp_limb_t *c_im,             \
+      bool c_im_neg, const mp_limb_t *max_sqr, long int tol_exp,               \
+      uint16_t max_itrs, bool *is_derivative                                   \
+    )                                                                          \
+    {                                                                          \
+        mp_limb_t z_re[N] = {0};                                               \
+        mp_limb_t z_im[N] = {0};                                               \
+        mp_limb_t re_old[N] = {0};                                             \
+        mp_limb_t im_old[N] = {0};                                             \
+        mp_limb_t re_sqr[N];                                                   \
+        mp_limb_t im_sqr[N];                                                   \
+        mp_limb_t abs_sqr[N];                                                  \
+        mp_limb_t prod[2 * (N)];                                               \
+        bool z_re_neg = false;                                                 \
+        bool z_im_neg = false;                                                 \
+        bool re_old_neg = false;                                               \
+        bool im_old_neg = false;                                               \
+        const long int tol_bit                                                 \
+          = tol_exp + (N) * GMP_NUMB_BITS - FIXED_INT_BITS;                    \
+        OrbitDerivative dz;                                                    \
+        _orbitDerivative_init(&dz);                                            \
+        *is_derivative = false;                                                \
+                                                                               \
+        int checkpoint = 1;                                                    \
+        for (uint16_t itrs = 1; itrs <= max_itrs; ++itrs) {                    \
+            if (itrs > 1) {                                                    \
+                _orbitDerivative_update(                                       \
+                  &dz, _fixed_to_double(z_re, z_re_neg, N),                    \
+                  _fixed_to_double(z_im, z_im_neg, N)                          \
+                );                                                             \
+            }                                                                  \
+                                                                               \
+            mpn_sqr(prod, z_re, N);                                            \
+            _fixed_reduce_product(re_sqr, prod, N, FIXED_TOP_FRAC_BITS);       \
+            mpn_sqr(prod, z_im, N);                                            \
+            _fixed_reduce_product(im_sqr, prod, N, FIXED_TOP_FRAC_BITS);       \
+                                                                               \
+            /* Shifting one bit less yields 2 z_re z_im */                     \
+            mpn_mul_n(prod, z_re, z_im, N);                                    \
+            _fixed_reduce_product(z_im, prod, N, FIXED_TOP_FRAC_BITS - 1);     \
+            const bool re_im_neg = (z_re_neg != z_im_neg);                     \
+            z_im_neg = _fixed_add(z_im, z_im, re_im_neg, c_im, c_im_neg, N);   \
+                                                                               \
+            z_re_neg = _fixed_add(z_re, re_sqr, false, im_sqr, true, N);       \
+            z_re_neg = _fixed_add(z_re, z_re, z_re_neg, c_re, c_re_neg, N);    \
+                                                                               \
+            CUTIL_UNUSED(mpn_add_n(abs_sqr, re_sqr, im_sqr, N));               \
+            if (mpn_cmp(abs_sqr, max_sqr, N) > 0) {                            \
+                return itrs;                                                   \
+            }                                                                  \
+                                                                               \
+            if (_fixed_is_close(                                               \
+                  z_re, z_re_neg, re_old, re_old_neg, prod, N, tol_bit         \
+                )                                                              \
+                && _fixed_is_close(                                            \
+                  z_im, z_im_neg, im_old, im_old_neg, prod, N, tol_bit         \
+                ))                                                             \
+            {                                                                  \
+                return 0;                                                      \
+            }                                                                  \
+                                                                               \
+            if (itrs >= checkpoint) {                                          \
+                if (_orbitDerivative_is_contracting(&dz)) {                    \
+                    *is_derivative = true;                                     \
+                    return 0;                                                  \
+                }                                                              \
+                checkpoint = _periodicity_next_checkpoint(itrs);               \
+                mpn_copyi(re_old, z_re, N);                                    \
+                mpn_copyi(im_old, z_im, N);                                    \
+                re_old_neg = z_re_neg;                                         \
+                im_old_neg = z_im_neg;                                         \
+            }                                                                  \
+        }                                                                      \
+                                                                               \
+        return 0; /* Converged I guess.. */                                    \
+    }
+
+FIXED_ITERATE_DEFINE(1)
+FIXED_ITERATE_DEFINE(2)
+FIXED_ITERATE_DEFINE(3)
+FIXED_ITERATE_DEFINE(4)
+FIXED_ITERATE_DEFINE(5)
+FIXED_ITERATE_DEFINE(6)
+FIXED_ITERATE_DEFINE(7)
+FIXED_ITERATE_DEFINE(8)
+FIXED_ITERATE_DEFINE(9)
+FIXED_ITERATE_DEFINE(10)
+FIXED_ITERATE_DEFINE(11)
+FIXED_ITERATE_DEFINE(12)
+FIXED_ITERATE_DEFINE(13)
+FIXED_ITERATE_DEFINE(14)
+FIXED_ITERATE_DEFINE(15)
+FIXED_ITERATE_DEFINE(16)
+
+typedef uint16_t (*FixedIterateFunc)(
+  const mp_limb_t *c_re, bool c_re_neg, const mp_limb_t *c_im, bool c_im_neg,
+  const mp_limb_t *max_sqr, long int tol_exp, uint16_t max_itrs,
+  bool *is_derivative
+);
+
+/* Fixed-limb iterations indexed by number of limbs */
+static const FixedIterateFunc FIXED_ITERATE_FUNCS[PIXEL_FIXED_MAX_LIMBS + 1] = {
+  NULL,
+  &_iterate_fixed_1,
+  &_iterate_fixed_2,
+  &_iterate_fixed_3,
+  &_iterate_fixed_4,
+  &_iterate_fixed_5,
+  &_iterate_fixed_6,
+  &_iterate_fixed_7,
+  &_iterate_fixed_8,
+  &_iterate_fixed_9,
+  &_iterate_fixed_10,
+  &_iterate_fixed_11,
+  &_iterate_fixed_12,
+  &_iterate_fixed_13,
+  &_iterate_fixed_14,
+  &_iterate_fixed_15,
+  &_iterate_fixed_16,
+};
+
+int
+PixelData_get_fixed_limbs(mp_bitcnt_t prec)
+{
+    const mp_bitcnt_t bits = prec + FIXED_INT_BITS;
+    const int limbs = (int) ((bits + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS);
+    return (limbs <= PIXEL_FIXED_MAX_LIMBS) ? limbs : 0;
+}
+
+/**
+ * Scalar double-precision iteration for position (`re`, `im`). Returns the
+ * iteration at which the position escaped or 0 if it (presumably) converged.
+ */
+static uint16_t
+_iterate_double(
+  double re, double im, double max_sqr, double tol, uint16_t max_itrs
+)
+{
+    double z_re = 0.0;
+    double z_im = 0.0;
+
+    double re_old = 0.0;
+    double im_old = 0.0;
+
+    int checkpoint = 1;
+    for (uint16_t itrs = 1; itrs <= max_itrs; ++itrs) {
+        const double re_sqr = z_re * z_re;
+        const double im_sqr = z_im * z_im;
+
+        z_im = 2.0 * z_im * z_re + im;
+        z_re = re_sqr - im_sqr + re;
+
+        if (re_sqr + im_sqr > max_sqr) {
+            return itrs;
+        }
+
+        if (_double_is_close(z_re, re_old, tol)
+            && _double_is_close(z_im, im_old, tol))
+        {
+            return 0;
+        }
+
+        if (itrs >= checkpoint) {
+            checkpoint = _periodicity_next_checkpoint(itrs);
+            re_old = z_re;
+            im_old = z_im;
+        }
+    }
+
+    return 0; /* Converged I guess.. */
+}
+
+/**
+ * Version of `_iterate_double` for several positions at once
+ */
+typedef void IterateLanes_fnc(
+  const double *re, const double *im, double max_sqr, double tol,
+  uint16_t max_itrs, uint16_t *res
+);
+
+#if CPU_HAVE_AVX512
+
+/**
+ * AVX-512 version of `_iterate_double` for AVX512_LANES positions at once.
+ * Each lane performs exactly the same operations as the scalar version.
+ */
+CPU_TARGET_AVX512 static void
+_iterate_double_lanes_avx512(
+  const double *re, const double *im, double max_sqr, double tol,
+  uint16_t max_itrs, uint16_t *res
+)
+{
+    const __m512d c_re = _mm512_loadu_pd(re);
+    const __m512d c_im = _mm512_loadu_pd(im);
+    const __m512d v_max_sqr = _mm512_set1_pd(max_sqr);
+    const __m512d v_two = _mm512_set1_pd(2.0);
+    const __m512d v_tol = _mm512_set1_pd(tol);
+    const __m512d v_zero = _mm512_setzero_pd();
+
+    __m512d z_re = v_zero;
+    __m512d z_im = v_zero;
+    __m512d re_old = v_zero;
+    __m512d im_old = v_zero;
+
+    __m512i v_res = _mm512_setzero_si512();
+    __mmask8 active = 0xFF;
+
+    int checkpoint = 1;
+    for (uint16_t itrs = 1; itrs <= max_itrs; ++itrs) {
+        const __m512d re_sqr = _mm512_mul_pd(z_re, z_re);
+        const __m512d im_sqr = _mm512_mul_pd(z_im, z_im);
+
+        const __m512d re_im = _mm512_mul_pd(_mm512_mul_pd(v_two, z_im), z_re);
+        z_im = _mm512_add_pd(re_im, c_im);
+        z_re = _mm512_add_pd(_mm512_sub_pd(re_sqr, im_sqr), c_re);
+
+        const __m512d abs_sqr = _mm512_add_pd(re_sqr, im_sqr);
+        const __mmask8 escaped
+          = _mm512_mask_cmp_pd_mask(active, abs_sqr, v_max_sqr, _CMP_GT_OQ);
+        v_res = _mm512_mask_set1_epi64(v_res, escaped, itrs);
+        active &= (__mmask8) ~escaped;
+
+        /* Vectorized version of `_double_is_close` */
+        const __m512d diff_re = _mm512_abs_pd(_mm512_sub_pd(z_re, re_old));
+        const __m512d diff_im = _mm512_abs_pd(_mm512_sub_pd(z_im, im_old));
+        const __mmask8 sim_re = _mm512_cmp_pd_mask(diff_re, v_tol, _CMP_LT_OQ);
+        const __mmask8 sim_im = _mm512_cmp_pd_mask(diff_im, v_tol, _CMP_LT_OQ);
+        active &= (__mmask8) ~(sim_re & sim_im);
+
+        if (active == 0) {
+            break;
+        }
+
+        if (itrs >= checkpoint) {
+            checkpoint = _periodicity_next_checkpoint(itrs);
+            re_old = z_re;
+            im_old = z_im;
+        }
+    }
+
+    uint64_t tmp[AVX512_LANES];
+    _mm512_storeu_si512(tmp, v_res);
+    for (int lane = 0; lane < AVX512_LANES; ++lane) {
+        res[lane] = (uint16_t) tmp[lane];
+    }
+}
+
+#endif
+
+#if CPU_HAVE_AVX2
+
+/**
+ * AVX2 version of `_iterate_double` for AVX2_LANES positions at once. Each
+ * lane performs exactly the same operations as the scalar version.
+ */
+CPU_TARGET_AVX2 static void
+_iterate_double_lanes_avx2(
+  const double *re, const double *im, double max_sqr, double tol,
+  uint16_t max_itrs, uint16_t *res
+)
+{
+    const __m256d c_re = _mm256_loadu_pd(re);
+    const __m256d c_im = _mm256_loadu_pd(im);
+    const __m256d v_max_sqr = _mm256_set1_pd(max_sqr);
+    const __m256d v_two = _mm256_set1_pd(2.0);
+    const __m256d v_tol = _mm256_set1_pd(tol);
+    const __m256d v_zero = _mm256_setzero_pd();
+    const __m256d v_sign = _mm256_set1_pd(-0.0);
+
+    __m256d z_re = v_zero;
+    __m256d z_im = v_zero;
+    __m256d re_old = v_zero;
+    __m256d im_old = v_zero;
+
+    __m256d v_res = v_zero;
+    __m256d active = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+
+    int checkpoint = 1;
+    for (uint16_t itrs = 1; itrs <= max_itrs; ++itrs) {
+        const __m256d re_sqr = _mm256_mul_pd(z_re, z_re);
+        const __m256d im_sqr = _mm256_mul_pd(z_im, z_im);
+
+        const __m256d re_im = _mm256_mul_pd(_mm256_mul_pd(v_two, z_im), z_re);
+        z_im = _mm256_add_pd(re_im, c_im);
+        z_re = _mm256_add_pd(_mm256_sub_pd(re_sqr, im_sqr), c_re);
+
+        const __m256d abs_sqr = _mm256_add_pd(re_sqr, im_sqr);
+        const __m256d escaped = _mm256_and_pd(
+          active, _mm256_cmp_pd(abs_sqr, v_max_sqr, _CMP_GT_OQ)
+        );
+        v_res = _mm256_blendv_pd(v_res, _mm256_set1_pd(itrs), escaped);
+        active = _mm256_andnot_pd(escaped, active);
+
+        /* Vectorized version of `_double_is_close` */
+        const __m256d diff_re
+          = _mm256_andnot_pd(v_sign, _mm256_sub_pd(z_re, re_old));
+        const __m256d diff_im
+          = _mm256_andnot_pd(v_sign, _mm256_sub_pd(z_im, im_old));
+        const __m256d sim_re = _mm256_cmp_pd(diff_re, v_tol, _CMP_LT_OQ);
+        const __m256d sim_im = _mm256_cmp_pd(diff_im, v_tol, _CMP_LT_OQ);
+        active = _mm256_andnot_pd(_mm256_and_pd(sim_re, sim_im), active);
+
+        if (_mm256_movemask_pd(active) == 0) {
+            break;
+        }
+
+        if (itrs >= checkpoint) {
+            checkpoint = _periodicity_next_checkpoint(itrs);
+            re_old = z_re;
+            im_old = z_im;
+        }
+    }
+
+    double tmp[AVX2_LANES];
+    _mm256_storeu_pd(tmp, v_res);
+    for (int lane = 0; lane < AVX2_LANES; ++lane) {
+        res[lane] = (uint16_t) tmp[lane];
+    }
+}
+
+#endif
+
+static void
+_iterate_double_lanes_baseline(
+  const double *re, const double *im, double max_sqr, double tol,
+  uint16_t max_itrs, uint16_t *res
+)
+{
+    res[0] = _iterate_double(re[0], im[0], max_sqr, tol, max_itrs);
+}
+
+/* Variant of the vectorized double-precision kernel in use */
+static struct {
+    IterateLanes_fnc *fnc;
+    int lanes;
+} _lanes = {&_iterate_double_lanes_baseline, 1};
+
+enum CpuIsa
+PixelData_select_isa(enum CpuIsa isa)
+{
+#if CPU_HAVE_AVX512
+    if (isa >= CPU_ISA_AVX512) {
+        _lanes.fnc = &_iterate_double_lanes_avx512;
+        _lanes.lanes = AVX512_LANES;
+        return CPU_ISA_AVX512;
+    }
+#endif
+#if CPU_HAVE_AVX2
+    if (isa >= CPU_ISA_AVX2) {
+        _lanes.fnc = &_iterate_double_lanes_avx2;
+        _lanes.lanes = AVX2_LANES;
+        return CPU_ISA_AVX2;
+    }
+#endif
+    CUTIL_UNUSED(isa);
+    _lanes.fnc = &_iterate_double_lanes_baseline;
+    _lanes.lanes = 1;
+    return CPU_ISA_BASELINE;
+}
+
+static inline void
+_pixelData_set_itrs(PixelData *px, uint16_t itrs, uint16_t max_itrs)
+{
+    px->itrs = (itrs == 0) ? 0.0F : 1.0F * itrs / max_itrs;
+    px->flags = PIXEL_FLAG_NONE;
+}
+
+bool
+PixelData_iterate_fixed(PixelData *px, PixelDataBuffer *buf, uint16_t max_itrs)
+{
+    const int num_limbs = PixelData_get_fixed_limbs(mpf_get_prec(px->re));
+    if (num_limbs == 0 || fabs(mpf_get_d(px->re)) >= FIXED_MAX_POS
+        || fabs(mpf_get_d(px->im)) >= FIXED_MAX_POS)
+    {
+        return false;
+    }
+
+    mp_limb_t c_re[PIXEL_FIXED_MAX_LIMBS];
+    mp_limb_t c_im[PIXEL_FIXED_MAX_LIMBS];
+    mp_limb_t max_sqr[PIXEL_FIXED_MAX_LIMBS];
+    const bool c_re_neg = _fixed_from_mpf(c_re, px->re, num_limbs);
+    const bool c_im_neg = _fixed_from_mpf(c_im, px->im, num_limbs);
+    CUTIL_UNUSED(_fixed_from_mpf(max_sqr, buf->max_sqr, num_limbs));
+
+    bool is_derivative = false;
+    const uint16_t itrs = FIXED_ITERATE_FUNCS[num_limbs](
+      c_re, c_re_neg, c_im, c_im_neg, max_sqr, buf->tol_exp, max_itrs,
+      &is_derivative
+    );
+    _pixelData_set_itrs(px, itrs, max_itrs);
+    if (is_derivative) {
+        px->flags = PIXEL_FLAG_DERIVATIVE;
+    }
+    return true;
+}
+
+void
+PixelData_iterate_double(
+  PixelData *px, double re, double im, double max_sqr, double tol,
+  uint16_t max_itrs
+)
+{
+    const uint16_t itrs = _iterate_double(re, im, max_sqr, tol, max_itrs);
+    _pixelData_set_itrs(px, itrs, max_itrs);
+}
+
+/**
+ * Iterates the `num` PixelData objects `stride` apart from each other starting
+ * at `px` for the positions (`re` + k * `d_re`, `im` + k * `d_im`) with the
+ * vectorized double-precision kernel in use.
+ */
+static void
+_pixelData_iterate_double_lanes(
+  PixelData *px, int stride, int num, double re, double im, double d_re,
+  double d_im, double max_sqr, double tol, uint16_t max_itrs
+)
+{
+    IterateLanes_fnc *const iterate_lanes = _lanes.fnc;
+    const int lanes = _lanes.lanes;
+
+    double lane_re[PIXEL_SEGMENT_MAX_LANES];
+    double lane_im[PIXEL_SEGMENT_MAX_LANES];
+    uint16_t lane_res[PIXEL_SEGMENT_MAX_LANES];
+
+    for (int idx = 0; idx < num; idx += lanes) {
+        /* Superfluous lanes are put at the origin, which converges at once */
+        for (int lane = 0; lane < lanes; ++lane) {
+            const bool is_used = (idx + lane < num);
+            lane_re[lane] = is_used ? re + (idx + lane) * d_re : 0.0;
+            lane_im[lane] = is_used ? im + (idx + lane) * d_im : 0.0;
+        }
+
+        iterate_lanes(lane_re, lane_im, max_sqr, tol, max_itrs, lane_res);
+
+        for (int lane = 0; lane < lanes && idx + lane < num; ++lane) {
+            PixelData *const lane_px = &px[(idx + lane) * stride];
+            _pixelData_set_itrs(lane_px, lane_res[lane], max_itrs);
+            lane_px->state = PIXEL_STATE_VALID;
+        }
+    }
+}
+
+void
+PixelData_iterate_double_segment(
+  PixelData *px, int num, double re, double im, double d_im, double max_sqr,
+  double tol, uint16_t max_itrs
+)
+{
+    _pixelData_iterate_double_lanes(
+      px, 1, num, re, im, 0.0, d_im, max_sqr, tol, max_itrs
+    );
+}
+
+void
+PixelData_iterate_double_column(
+  PixelData *px, int stride, int num, double re, double im, double d_re,
+  double max_sqr, double tol, uint16_t max_itrs
+)
+{
+    _pixelData_iterate_double_lanes(
+      px, stride, num, re, im, d_re, 0.0, max_sqr, tol, max_itrs
+    );
+}
+
+void
+PixelData_iterate_double_line(
+  PixelData *px, int stride, int num, double re, double im, double d_re,
+  double d_im, double max_sqr, double tol, uint16_t max_itrs
+)
+{
+    _pixelData_iterate_double_lanes(
+      px, stride, num, re, im, d_re, d_im, max_sqr, tol, max_itrs
+    );
+}
+
+bool
+PixelData_iterate_interval(
+  PixelData *px, Interval re, Interval im, double max_sqr, uint16_t max_itrs
+)
+{
+    Interval z_re = Interval_from_bounds(0.0, 0.0);
+    Interval z_im = Interval_from_bounds(0.0, 0.0);
+
+    Interval re_old = z_re;
+    Interval im_old = z_im;
+
+    int checkpoint = 1;
+    for (uint16_t itrs = 1; itrs <= max_itrs; ++itrs) {
+        const Interval re_sqr = Interval_sqr(z_re);
+        const Interval im_sqr = Interval_sqr(z_im);
+
+        const Interval abs_sqr = Interval_add(re_sqr, im_sqr);
+        if (abs_sqr.lo > max_sqr) {
+            _pixelData_set_itrs(px, itrs, max_itrs);
+            return true;
+        }
+        if (abs_sqr.hi > max_sqr) {
+            return false;
+        }
+
+        z_im = Interval_add(Interval_mul(Interval_mul_2(z_im), z_re), im);
+        z_re = Interval_add(Interval_sub(re_sqr, im_sqr), re);
+
+        /* Orbits are trapped in the enclosures since the last checkpoint */
+        if (Interval_is_subset(z_re, re_old)
+            && Interval_is_subset(z_im, im_old))
+        {
+            _pixelData_set_itrs(px, 0, max_itrs);
+            return true;
+        }
+
+        if (itrs >= checkpoint) {
+            checkpoint = _periodicity_next_checkpoint(itrs);
+            re_old = z_re;
+            im_old = z_im;
+        }
+    }
+
+    _pixelData_set_itrs(px, 0, max_itrs);
+    return true;
+}
+
+/**
+ * Long-double version of `_iterate_double`. The periodicity check is performed
+ * on doubles, which is accurate enough.
+ */
+static uint16_t
+_iterate_ldouble(
+  long double re, long double im, double max_sqr, double tol,
+  uint16_t max_itrs
+)
+{
+    long double z_re = 0.0L;
+    long double z_im = 0.0L;
+
+    double re_old = 0.0;
+    double im_old = 0.0;
+
+    int checkpoint = 1;
+    for (uint16_t itrs = 1; itrs <= max_itrs; ++itrs) {
+        const long double re_sqr = z_re * z_re;
+        const long double im_sqr = z_im * z_im;
+
+        z_im = 2.0L * z_im * z_re + im;
+        z_re = re_sqr - im_sqr + re;
+
+        if (re_sqr + im_sqr > max_sqr) {
+            return itrs;
+        }
+
+        if (_double_is_close((double) z_re, re_old, tol)
+            && _double_is_close((double) z_im, im_old, tol))
+        {
+            return 0;
+        }
+
+        if (itrs >= checkpoint) {
+            checkpoint = _periodicity_next_checkpoint(itrs);
+            re_old = (double) z_re;
+            im_old = (double) z_im;
+        }
+    }
+
+    return 0;
+}
+
+void
+PixelData_iterate_ldouble(
+  PixelData *px, long double re, long double im, double max_sqr, double tol,
+  uint16_t max_itrs
+)
+{
+    const uint16_t itrs = _iterate_ldouble(re, im, max_sqr, tol, max_itrs);
+    _pixelData_set_itrs(px, itrs, max_itrs);
+}
+
+/**
+ * Double-double version of `_iterate_double`. The escape and periodicity checks
+ * only use the leading components, which is accurate enough for both.
+ */
+static uint16_t
+_iterate_ddouble(
+  DoubleDouble re, DoubleDouble im, double max_sqr, double tol,
+  uint16_t max_itrs
+)
+{
+    DoubleDouble z_re = DoubleDouble_from_double(0.0);
+    DoubleDouble z_im = DoubleDouble_from_double(0.0);
+
+    double re_old = 0.0;
+    double im_old = 0.0;
+
+    int checkpoint = 1;
+    for (uint16_t itrs = 1; itrs <= max_itrs; ++itrs) {
+        const DoubleDouble re_sqr = DoubleDouble_sqr(z_re);
+        const DoubleDouble im_sqr = DoubleDouble_sqr(z_im);
+
+        /* Doubling is exact componentwise */
+        DoubleDouble re_im = DoubleDouble_mul(z_re, z_im);
+        re_im.hi *= 2.0;
+        re_im.lo *= 2.0;
+        z_im = DoubleDouble_add(re_im, im);
+        z_re = DoubleDouble_add(DoubleDouble_sub(re_sqr, im_sqr), re);
+
+        if (re_sqr.hi + im_sqr.hi > max_sqr) {
+            return itrs;
+        }
+
+        if (_double_is_close(z_re.hi, re_old, tol)
+            && _double_is_close(z_im.hi, im_old, tol))
+        {
+            return 0;
+        }
+
+        if (itrs >= checkpoint) {
+            checkpoint = _periodicity_next_checkpoint(itrs);
+            re_old = z_re.hi;
+            im_old = z_im.hi;
+        }
+    }
+
+    return 0; /* Converged I guess.. */
+}
+
+void
+PixelData_iterate_ddouble(
+  PixelData *px, DoubleDouble re, DoubleDouble im, double max_sqr,
+  double tol, uint16_t max_itrs
+)
+{
+    const uint16_t itrs = _iterate_ddouble(re, im, max_sqr, tol, max_itrs);
+    _pixelData_set_itrs(px, itrs, max_itrs);
+}
+
+/**
+ * Quad-double version of `_iterate_double`. The escape and periodicity checks
+ * only use the leading components, which is accurate enough for both.
+ */
+static uint16_t
+_iterate_qdouble(
+  QuadDouble re, QuadDouble im, double max_sqr, double tol, uint16_t max_itrs
+)
+{
+    QuadDouble z_re = QuadDouble_from_double(0.0);
+    QuadDouble z_im = QuadDouble_from_double(0.0);
+
+    double re_old = 0.0;
+    double im_old = 0.0;
+
+    int checkpoint = 1;
+    for (uint16_t itrs = 1; itrs <= max_itrs; ++itrs) {
+        const QuadDouble re_sqr = QuadDouble_mul(z_re, z_re);
+        const QuadDouble im_sqr = QuadDouble_mul(z_im, z_im);
+
+        /* Doubling is exact componentwise */
+        QuadDouble re_im = QuadDouble_mul(z_re, z_im);
+        for (int i = 0; i < 4; ++i) {
+            re_im.x[i] *= 2.0;
+        }
+        z_im = QuadDouble_add(re_im, im);
+        z_re = QuadDouble_add(QuadDouble_sub(re_sqr, im_sqr), re);
+
+        if (re_sqr.x[0] + im_sqr.x[0] > max_sqr) {
+            return itrs;
+        }
+
+        if (_double_is_close(z_re.x[0], re_old, tol)
+            && _double_is_close(z_im.x[0], im_old, tol))
+        {
+            return 0;
+        }
+
+        if (itrs >= checkpoint) {
+            checkpoint = _periodicity_next_checkpoint(itrs);
+            re_old = z_re.x[0];
+            im_old = z_im.x[0];
+        }
+    }
+
+    return 0; /* Converged I guess.. */
+}
+
+void
+PixelData_iterate_qdouble(
+  PixelData *px, QuadDouble re, QuadDouble im, double max_sqr, double tol,
+  uint16_t max_itrs
+)
+{
+    const uint16_t itrs = _iterate_qdouble(re, im, max_sqr, tol, max_itrs);
+    _pixelData_set_itrs(px, itrs, max_itrs);
+}
+
+/**
+ * Continues the perturbation of `px` with the difference (`d_re`, `d_im`) to
+ * the reference orbit after `start` iterations.
+ */
+static bool
+_pixelData_iterate_perturbed_from(
+  PixelData *px, const ReferenceOrbit *orbit, const BlaTable *bla,
+  double dc_re, double dc_im, int start, double d_re, double d_im,
+  double max_sqr, double tol, uint16_t max_itrs
+)
+{
+    const double *const orbit_re = orbit->orbit_re;
+    const double *const orbit_im = orbit->orbit_im;
+    const int len = orbit->len;
+
+    double re_old = 0.0;
+    double im_old = 0.0;
+
+    int checkpoint = start + 1;
+    int steps = 1;
+    for (int itrs = start + 1; itrs <= max_itrs; itrs += steps) {
+        const double ref_re = orbit_re[itrs - 1];
+        const double ref_im = orbit_im[itrs - 1];
+        const double z_re = ref_re + d_re;
+        const double z_im = ref_im + d_im;
+        const double z_sqr = z_re * z_re + z_im * z_im;
+
+        if (z_sqr > max_sqr) {
+            _pixelData_set_itrs(px, itrs, max_itrs);
+            return true;
+        }
+
+        if (z_sqr < GLITCH_TOLERANCE * (ref_re * ref_re + ref_im * ref_im)) {
+            px->state = PIXEL_STATE_GLITCHED;
+            return true;
+        }
+
+        if (itrs >= len) {
+            return false;
+        }
+
+        const BlaEntry *entry = NULL;
+        if (bla != NULL) {
+            const double d_sqr = d_re * d_re + d_im * d_im;
+            const int max_steps = max_itrs - itrs;
+            entry = BlaTable_lookup(bla, itrs - 1, d_sqr, max_steps, &steps);
+        }
+
+        if (entry != NULL) {
+            /* d_{n+l} = A d_n + B dc */
+            const double tmp_re = entry->a_re * d_re - entry->a_im * d_im
+                                  + entry->b_re * dc_re - entry->b_im * dc_im;
+            d_im = entry->a_re * d_im + entry->a_im * d_re
+                   + entry->b_re * dc_im + entry->b_im * dc_re;
+            d_re = tmp_re;
+        } else {
+            /* d_{n+1} = (2 Z_n + d_n) d_n + dc */
+            const double sum_re = 2.0 * ref_re + d_re;
+            const double sum_im = 2.0 * ref_im + d_im;
+            const double tmp_re = sum_re * d_re - sum_im * d_im + dc_re;
+            d_im = sum_re * d_im + sum_im * d_re + dc_im;
+            d_re = tmp_re;
+            steps = 1;
+        }
+
+        const double new_re = orbit_re[itrs - 1 + steps] + d_re;
+        const double new_im = orbit_im[itrs - 1 + steps] + d_im;
+        if (_double_is_close(new_re, re_old, tol)
+            && _double_is_close(new_im, im_old, tol))
+        {
+            _pixelData_set_itrs(px, 0, max_itrs);
+            return true;
+        }
+
+        if (itrs >= checkpoint) {
+            checkpoint = _periodicity_next_checkpoint(itrs);
+            re_old = new_re;
+            im_old = new_im;
+        }
+    }
+
+    _pixelData_set_itrs(px, 0, max_itrs);
+    return true;
+}
+
+bool
+PixelData_iterate_perturbed(
+  PixelData *px, const ReferenceOrbit *orbit, const BlaTable *bla,
+  double dc_re, double dc_im, uint16_t skip, double max_sqr, double tol,
+  uint16_t max_itrs
+)
+{
+    double d_re = 0.0;
+    double d_im = 0.0;
+    if (skip > 0) {
+        ReferenceOrbit_approximate(orbit, skip, dc_re, dc_im, &d_re, &d_im);
+    }
+
+    return _pixelData_iterate_perturbed_from(
+      px, orbit, bla, dc_re, dc_im, skip, d_re, d_im, max_sqr, tol, max_itrs
+    );
+}
+
+/**
+ * Returns the larger exponent of `re` and `im`, LONG_MIN if both are zero.
+ */
+static inline long
+_floatExp_max_exp(FloatExp re, FloatExp im)
+{
+    const long exp_re = (re.mant != 0.0) ? re.exp : LONG_MIN;
+    const long exp_im = (im.mant != 0.0) ? im.exp : LONG_MIN;
+    return (exp_re > exp_im) ? exp_re : exp_im;
+}
+
+bool
+PixelData_iterate_perturbed_floatexp(
+  PixelData *px, const ReferenceOrbit *orbit, const BlaTable *bla,
+  FloatExp dc_re, FloatExp dc_im, double max_sqr, double tol,
+  uint16_t max_itrs
+)
+{
+    const double *const orbit_re = orbit->orbit_re;
+    const double *const orbit_im = orbit->orbit_im;
+    const int len = orbit->len;
+
+    const long exp_dc = _floatExp_max_exp(dc_re, dc_im);
+    if (exp_dc == LONG_MIN || exp_dc > FLOATEXP_HANDOFF_EXP) {
+        return _pixelData_iterate_perturbed_from(
+          px, orbit, bla, FloatExp_to_double(dc_re), FloatExp_to_double(dc_im),
+          0, 0.0, 0.0, max_sqr, tol, max_itrs
+        );
+    }
+
+    FloatExp d_re = FloatExp_from_double(0.0);
+    FloatExp d_im = FloatExp_from_double(0.0);
+
+    double re_old = 0.0;
+    double im_old = 0.0;
+
+    int checkpoint = 1;
+    for (int itrs = 1; itrs <= max_itrs; ++itrs) {
+        /* Hand off once the difference is in range and dc is negligible */
+        const long exp_d = _floatExp_max_exp(d_re, d_im);
+        if (exp_d > FLOATEXP_HANDOFF_EXP
+            && exp_d - FLOATEXP_MAX_EXP_DIFF > exp_dc)
+        {
+            return _pixelData_iterate_perturbed_from(
+              px, orbit, bla, FloatExp_to_double(dc_re),
+              FloatExp_to_double(dc_im), itrs - 1, FloatExp_to_double(d_re),
+              FloatExp_to_double(d_im), max_sqr, tol, max_itrs
+            );
+        }
+
+        const double ref_re = orbit_re[itrs - 1];
+        const double ref_im = orbit_im[itrs - 1];
+        const double z_re = ref_re + FloatExp_to_double(d_re);
+        const double z_im = ref_im + FloatExp_to_double(d_im);
+        const double z_sqr = z_re * z_re + z_im * z_im;
+
+        if (z_sqr > max_sqr) {
+            _pixelData_set_itrs(px, itrs, max_itrs);
+            return true;
+        }
+
+        if (z_sqr < GLITCH_TOLERANCE * (ref_re * ref_re + ref_im * ref_im)) {
+            px->state = PIXEL_STATE_GLITCHED;
+            return true;
+        }
+
+        if (itrs >= len) {
+            return false;
+        }
+
+        /* d_{n+1} = (2 Z_n + d_n) d_n + dc */
+        const FloatExp sum_re
+          = FloatExp_add(FloatExp_from_double(2.0 * ref_re), d_re);
+        const FloatExp sum_im
+          = FloatExp_add(FloatExp_from_double(2.0 * ref_im), d_im);
+        const FloatExp tmp_re = FloatExp_add(
+          FloatExp_sub(FloatExp_mul(sum_re, d_re), FloatExp_mul(sum_im, d_im)),
+          dc_re
+        );
+        d_im = FloatExp_add(
+          FloatExp_add(FloatExp_mul(sum_re, d_im), FloatExp_mul(sum_im, d_re)),
+          dc_im
+        );
+        d_re = tmp_re;
+
+        const double new_re = orbit_re[itrs] + FloatExp_to_double(d_re);
+        const double new_im = orbit_im[itrs] + FloatExp_to_double(d_im);
+        if (_double_is_close(new_re, re_old, tol)
+            && _double_is_close(new_im, im_old, tol))
+        {
+            _pixelData_set_itrs(px, 0, max_itrs);
+            return true;
+        }
+
+        if (itrs >= checkpoint) {
+            checkpoint = _periodicity_next_checkpoint(itrs);
+            re_old = new_re;
+            im_old = new_im;
+        }
+    }
+
+    _pixelData_set_itrs(px, 0, max_itrs);
+    return true;
+}
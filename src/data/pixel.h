@@ -11,6 +11,15 @@
 
 #include <gmp.h>
 
+#include <cutil/std/stdbool.h>
+
+#include <data/bla.h>
+#include <data/orbit.h>
+#include <util/cpu.h>
+#include <util/floatexp.h>
+#include <util/interval.h>
+#include <util/multidouble.h>
+
 /**
  * Struct for buffer of thread-safe variables
  */
@@ -24,6 +33,7 @@ typedef struct {
     mpf_t re_old;
     mpf_t im_old;
     mpf_t tmp;
+    long int tol_exp; /* Orbit points closer than 2^tol_exp form a cycle */
 } PixelDataBuffer;
 
 /**
@@ -52,6 +62,17 @@ PixelDataBuffer_clear(PixelDataBuffer *buf);
 void
 PixelDataBuffer_set_prec(PixelDataBuffer *buf, mp_bitcnt_t prec);
 
+/**
+ * Sets the tolerance of the cycle detection in `buf` according to the units
+ * per pixel `upp` and the current precision of `buf`. Has to be called again
+ * after the precision changed.
+ *
+ * @param[in] buf PixelDataBuffer object to set tolerance of
+ * @param[in] upp units per pixel of current view
+ */
+void
+PixelDataBuffer_set_tolerance(PixelDataBuffer *buf, mpf_srcptr upp);
+
 /**
  * Possible pixel states
  */
@@ -59,6 +80,33 @@ enum PixelState {
     PIXEL_STATE_INVALID = -1,
     PIXEL_STATE_VALID = 0,
     PIXEL_STATE_INTERPOLATED,
+    PIXEL_STATE_GLITCHED,
+};
+
+/**
+ * Possible arithmetic kernels for pixel iterations
+ */
+enum PixelKernel {
+    PIXEL_KERNEL_MPF = 0,
+    PIXEL_KERNEL_DOUBLE,
+    PIXEL_KERNEL_PERTURBATION,
+    PIXEL_KERNEL_FLOATEXP,
+    PIXEL_KERNEL_DDOUBLE,
+    PIXEL_KERNEL_QDOUBLE,
+    PIXEL_KERNEL_LDOUBLE,
+    PIXEL_KERNEL_FIXED,
+};
+
+/**
+ * Flags on how the result of a pixel was obtained
+ */
+enum PixelFlag {
+    PIXEL_FLAG_NONE = 0,
+    PIXEL_FLAG_DERIVATIVE = 1 << 0, /* Interior by vanishing derivative only */
+    PIXEL_FLAG_FILLED = 1 << 1,     /* Copied from border without iterating */
+    PIXEL_FLAG_PROVEN = 1 << 2,     /* Filled by interval arithmetic proof */
+    PIXEL_FLAG_MIRRORED = 1 << 3,   /* Copied from conjugate pixel */
+    PIXEL_FLAG_GUESSED = 1 << 4,    /* Skipped in the current coarse pass */
 };
 
 /**
@@ -69,6 +117,7 @@ typedef struct {
     mpf_t im;
     float itrs;
     enum PixelState state;
+    unsigned int flags; /* Combination of PixelFlag values */
 } PixelData;
 
 /**
@@ -100,6 +149,12 @@ PixelData_set_prec(PixelData *px, mp_bitcnt_t prec);
  * Performs actual Mandelbrot iterations on PixelData `px` for position in
  * PixelDataBuffer `buf` up to at most `max_itrs`.
  *
+ * Besides the cycle detection, the derivative of the orbit with respect to its
+ * first point is tracked in doubles. Once it has become negligible, the orbit
+ * is contracting onto an attracting cycle and `px` is considered interior. As
+ * this can be fooled by orbits lingering close to 0 before escaping, it is
+ * marked by PIXEL_FLAG_DERIVATIVE. The flags of `px` are reset otherwise.
+ *
  * @param[in] px PixelData to work with
  * @param[in] buf PixelDataBuffer to use for iteration
  * @param[in] max_itrs maximum number of iterations to perform
@@ -107,4 +162,308 @@ PixelData_set_prec(PixelData *px, mp_bitcnt_t prec);
 void
 PixelData_iterate(PixelData *px, PixelDataBuffer *buf, uint16_t max_itrs);
 
+/**
+ * Maximum number of limbs of the fixed-limb kernel
+ */
+#define PIXEL_FIXED_MAX_LIMBS 16
+
+/**
+ * Returns the number of limbs the fixed-limb kernel uses for precision `prec`,
+ * 0 if it exceeds PIXEL_FIXED_MAX_LIMBS.
+ *
+ * @param[in] prec precision of the positions
+ *
+ * @return number of limbs, 0 if precision is too high
+ */
+int
+PixelData_get_fixed_limbs(mp_bitcnt_t prec);
+
+/**
+ * Performs Mandelbrot iterations on PixelData `px` like `PixelData_iterate`,
+ * but directly on fixed-point numbers of GMP limbs instead of mpf. The number
+ * of limbs is given by `PixelData_get_fixed_limbs` for the precision of `px`,
+ * for which a specialized iteration with all buffers on the stack is compiled.
+ * Squares use dedicated squaring and the periodicity check only compares the
+ * leading limbs. The derivative is tracked like in `PixelData_iterate`.
+ * Returns false if the precision is too high or the position too large for
+ * fixed point, in which case `px` remains unchanged.
+ *
+ * @param[in] px PixelData to work with
+ * @param[in] buf PixelDataBuffer to take maximum absolute square from
+ * @param[in] max_itrs maximum number of iterations to perform
+ *
+ * @return false if `px` cannot be handled in fixed point, true otherwise
+ */
+bool
+PixelData_iterate_fixed(PixelData *px, PixelDataBuffer *buf, uint16_t max_itrs);
+
+/**
+ * Returns the absolute tolerance of the cycle detection of the kernels using
+ * hardware floating-point numbers for pixels at distance `upp`: orbit points
+ * closer than this in both components are considered a cycle. It lies 10
+ * binary digits below `upp`, but well above the rounding errors of double.
+ *
+ * @param[in] upp distance of adjacent pixels
+ *
+ * @return tolerance of cycle detection
+ */
+double
+PixelData_get_tolerance(double upp);
+
+/**
+ * Performs Mandelbrot iterations on PixelData `px` for position (`re`, `im`) up
+ * to at most `max_itrs` using hardware floating-point numbers. Only the
+ * iteration results of `px` are written, its mpf fields remain untouched.
+ * Should only be used if the position can be represented safely by doubles.
+ *
+ * @param[in] px PixelData to write results to
+ * @param[in] re real part of position
+ * @param[in] im imaginary part of position
+ * @param[in] max_sqr maximum absolute square for iteration
+ * @param[in] tol tolerance of cycle detection (see PixelData_get_tolerance)
+ * @param[in] max_itrs maximum number of iterations to perform
+ */
+void
+PixelData_iterate_double(
+  PixelData *px, double re, double im, double max_sqr, double tol,
+  uint16_t max_itrs
+);
+
+/**
+ * Selects the variant of the vectorized double-precision kernel used by
+ * `PixelData_iterate_double_segment`, i.e., the most capable one that does not
+ * exceed `isa` and has been compiled. Should be called before any iteration,
+ * the baseline variant is used until then.
+ *
+ * @param[in] isa most capable instruction set to use
+ *
+ * @return instruction set of the selected variant
+ */
+enum CpuIsa
+PixelData_select_isa(enum CpuIsa isa);
+
+/**
+ * Performs Mandelbrot iterations on the `num` consecutive PixelData objects
+ * starting at `px` for the positions (`re`, `im` + k * `d_im`), k = 0, ...,
+ * `num` - 1, up to at most `max_itrs`. Depending on the variant selected by
+ * `PixelData_select_isa`, the pixels are processed in vector lanes (8 for
+ * AVX-512, 4 for AVX2) with per-lane escape masks. Writes the results and sets
+ * the state to PIXEL_STATE_VALID for all pixels, mpf fields remain untouched.
+ *
+ * Each lane performs the same operations as `PixelData_iterate_double`, so the
+ * escape counts are identical unless the compiler contracts the scalar version
+ * differently (e.g. using fused multiply-add). Then, pixels extremely close to
+ * the boundary of the set may escape a few iterations apart or even converge
+ * in one version only.
+ *
+ * @param[in] px array of PixelData to write results to
+ * @param[in] num number of pixels in `px`
+ * @param[in] re real part of all positions
+ * @param[in] im imaginary part of first position
+ * @param[in] d_im difference of imaginary parts of adjacent positions
+ * @param[in] max_sqr maximum absolute square for iteration
+ * @param[in] tol tolerance of cycle detection (see PixelData_get_tolerance)
+ * @param[in] max_itrs maximum number of iterations to perform
+ */
+void
+PixelData_iterate_double_segment(
+  PixelData *px, int num, double re, double im, double d_im, double max_sqr,
+  double tol, uint16_t max_itrs
+);
+
+/**
+ * Column version of `PixelData_iterate_double_segment`, i.e., performs
+ * Mandelbrot iterations on the `num` PixelData objects `stride` apart from each
+ * other starting at `px` for the positions (`re` + k * `d_re`, `im`), k = 0,
+ * ..., `num` - 1, up to at most `max_itrs`.
+ *
+ * @param[in] px array of PixelData to write results to
+ * @param[in] stride distance of adjacent PixelData objects in `px`
+ * @param[in] num number of pixels to iterate
+ * @param[in] re real part of first position
+ * @param[in] im imaginary part of all positions
+ * @param[in] d_re difference of real parts of adjacent positions
+ * @param[in] max_sqr maximum absolute square for iteration
+ * @param[in] tol tolerance of cycle detection (see PixelData_get_tolerance)
+ * @param[in] max_itrs maximum number of iterations to perform
+ */
+void
+PixelData_iterate_double_column(
+  PixelData *px, int stride, int num, double re, double im, double d_re,
+  double max_sqr, double tol, uint16_t max_itrs
+);
+
+/**
+ * General version of `PixelData_iterate_double_segment`, i.e., performs
+ * Mandelbrot iterations on the `num` PixelData objects `stride` apart from each
+ * other starting at `px` for the positions (`re` + k * `d_re`, `im` + k *
+ * `d_im`), k = 0, ..., `num` - 1, up to at most `max_itrs`. This covers lines
+ * of pixels that skip pixels in between.
+ *
+ * @param[in] px array of PixelData to write results to
+ * @param[in] stride distance of adjacent PixelData objects in `px`
+ * @param[in] num number of pixels to iterate
+ * @param[in] re real part of first position
+ * @param[in] im imaginary part of first position
+ * @param[in] d_re difference of real parts of adjacent positions
+ * @param[in] d_im difference of imaginary parts of adjacent positions
+ * @param[in] max_sqr maximum absolute square for iteration
+ * @param[in] tol tolerance of cycle detection (see PixelData_get_tolerance)
+ * @param[in] max_itrs maximum number of iterations to perform
+ */
+void
+PixelData_iterate_double_line(
+  PixelData *px, int stride, int num, double re, double im, double d_re,
+  double d_im, double max_sqr, double tol, uint16_t max_itrs
+);
+
+/**
+ * Performs Mandelbrot iterations on the rectangle `re` times `im` of positions
+ * at once in interval arithmetic up to at most `max_itrs`. Returns whether all
+ * positions in the rectangle provably have the same result, i.e., escape at
+ * the same iteration or stay bounded, in which case it is written to `px`.
+ * Only the iteration results of `px` are written, its mpf fields remain
+ * untouched.
+ *
+ * Positions stay bounded if the enclosure of their orbits returns into itself,
+ * so the proof also succeeds before `max_itrs` for rectangles inside of
+ * attracting components.
+ *
+ * @param[in] px PixelData to write results to
+ * @param[in] re interval of real parts of positions
+ * @param[in] im interval of imaginary parts of positions
+ * @param[in] max_sqr maximum absolute square for iteration
+ * @param[in] max_itrs maximum number of iterations to perform
+ *
+ * @return whether all positions have the same result
+ */
+bool
+PixelData_iterate_interval(
+  PixelData *px, Interval re, Interval im, double max_sqr, uint16_t max_itrs
+);
+
+/**
+ * Performs Mandelbrot iterations on PixelData `px` for position (`re`, `im`) up
+ * to at most `max_itrs` using long doubles (LDBL_MANT_DIG bits, i.e., 64 bits
+ * for x87 extended precision). Only the iteration results of `px` are written,
+ * its mpf fields remain untouched. Should only be used if the position can be
+ * represented safely by long doubles.
+ *
+ * @param[in] px PixelData to write results to
+ * @param[in] re real part of position
+ * @param[in] im imaginary part of position
+ * @param[in] max_sqr maximum absolute square for iteration
+ * @param[in] tol tolerance of cycle detection (see PixelData_get_tolerance)
+ * @param[in] max_itrs maximum number of iterations to perform
+ */
+void
+PixelData_iterate_ldouble(
+  PixelData *px, long double re, long double im, double max_sqr, double tol,
+  uint16_t max_itrs
+);
+
+/**
+ * Performs Mandelbrot iterations on PixelData `px` for position (`re`, `im`) up
+ * to at most `max_itrs` using double-double numbers (about 106 bits). Only the
+ * iteration results of `px` are written, its mpf fields remain untouched.
+ * Should only be used if the position can be represented safely by
+ * double-doubles.
+ *
+ * @param[in] px PixelData to write results to
+ * @param[in] re real part of position
+ * @param[in] im imaginary part of position
+ * @param[in] max_sqr maximum absolute square for iteration
+ * @param[in] tol tolerance of cycle detection (see PixelData_get_tolerance)
+ * @param[in] max_itrs maximum number of iterations to perform
+ */
+void
+PixelData_iterate_ddouble(
+  PixelData *px, DoubleDouble re, DoubleDouble im, double max_sqr,
+  double tol, uint16_t max_itrs
+);
+
+/**
+ * Performs Mandelbrot iterations on PixelData `px` for position (`re`, `im`) up
+ * to at most `max_itrs` using quad-double numbers (about 212 bits). Only the
+ * iteration results of `px` are written, its mpf fields remain untouched.
+ * Should only be used if the position can be represented safely by
+ * quad-doubles.
+ *
+ * @param[in] px PixelData to write results to
+ * @param[in] re real part of position
+ * @param[in] im imaginary part of position
+ * @param[in] max_sqr maximum absolute square for iteration
+ * @param[in] tol tolerance of cycle detection (see PixelData_get_tolerance)
+ * @param[in] max_itrs maximum number of iterations to perform
+ */
+void
+PixelData_iterate_qdouble(
+  PixelData *px, QuadDouble re, QuadDouble im, double max_sqr, double tol,
+  uint16_t max_itrs
+);
+
+/**
+ * Performs Mandelbrot iterations on PixelData `px` up to at most `max_itrs` by
+ * perturbation, i.e., by only iterating the difference of `px` to the
+ * reference orbit `orbit` in hardware floating-point numbers. The difference of
+ * the position of `px` to the reference point is given by (`dc_re`, `dc_im`).
+ * The first `skip` iterations are replaced by the series approximation of
+ * `orbit` (see ReferenceOrbit_get_skip). If `bla` is not NULL, multiple
+ * iterations are performed at once by its BLAs whenever possible. Only the
+ * iteration results of `px` are written. Returns false if `px` outlives
+ * `orbit`, in which case `px` remains unchanged.
+ *
+ * If the perturbed orbit point becomes small compared to the orbit point of
+ * `orbit`, the rounding errors of the difference dominate and the result
+ * cannot be trusted. Such a glitched pixel is flagged by setting its state to
+ * PIXEL_STATE_GLITCHED without writing its iteration result. It has to be
+ * iterated again with a different reference orbit.
+ *
+ * @param[in] px PixelData to write results to
+ * @param[in] orbit ReferenceOrbit to perturb
+ * @param[in] bla BlaTable along `orbit` (may be NULL)
+ * @param[in] dc_re real part of difference to reference point
+ * @param[in] dc_im imaginary part of difference to reference point
+ * @param[in] skip number of iterations to skip
+ * @param[in] max_sqr maximum absolute square for iteration
+ * @param[in] tol tolerance of cycle detection (see PixelData_get_tolerance)
+ * @param[in] max_itrs maximum number of iterations to perform
+ *
+ * @return false if `px` outlives `orbit`, true otherwise
+ */
+bool
+PixelData_iterate_perturbed(
+  PixelData *px, const ReferenceOrbit *orbit, const BlaTable *bla,
+  double dc_re, double dc_im, uint16_t skip, double max_sqr, double tol,
+  uint16_t max_itrs
+);
+
+/**
+ * Performs Mandelbrot iterations on PixelData `px` up to at most `max_itrs` by
+ * perturbation like `PixelData_iterate_perturbed`, but for differences
+ * (`dc_re`, `dc_im`) to the reference point that are beyond the range of
+ * double. The difference to the reference orbit is iterated as FloatExp until
+ * it has grown large enough to be continued in hardware floating-point numbers.
+ * Only the iteration results of `px` are written. Returns false if `px`
+ * outlives `orbit`, in which case `px` remains unchanged. Glitched pixels are
+ * flagged as for `PixelData_iterate_perturbed`.
+ *
+ * @param[in] px PixelData to write results to
+ * @param[in] orbit ReferenceOrbit to perturb
+ * @param[in] bla BlaTable along `orbit` (may be NULL)
+ * @param[in] dc_re real part of difference to reference point
+ * @param[in] dc_im imaginary part of difference to reference point
+ * @param[in] max_sqr maximum absolute square for iteration
+ * @param[in] tol tolerance of cycle detection (see PixelData_get_tolerance)
+ * @param[in] max_itrs maximum number of iterations to perform
+ *
+ * @return false if `px` outlives `orbit`, true otherwise
+ */
+bool
+PixelData_iterate_perturbed_floatexp(
+  PixelData *px, const ReferenceOrbit *orbit, const BlaTable *bla,
+  FloatExp dc_re, FloatExp dc_im, double max_sqr, double tol,
+  uint16_t max_itrs
+);
+
 #endif /* MANDELBROT_DATA_PIXEL_H_INCLUDED */
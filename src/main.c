@@ -25,6 +25,8 @@ enum {
     PALETTE_IDX_IDX,
     TRIP_MODE_IDX,
     VIEW_FILE_IDX,
+    KERNEL_IDX,
+    FILL_IDX,
     LONGOPTS_ONLY_END_IDX,
 };
 
@@ -46,6 +48,8 @@ static const cutil_Option LONGOPTS[] = {
   {"palette_idx", CUTIL_OPTION_REQUIRED_ARGUMENT, NULL, PALETTE_IDX_IDX},
   {"trip_mode", CUTIL_OPTION_REQUIRED_ARGUMENT, NULL, TRIP_MODE_IDX},
   {"view_file", CUTIL_OPTION_REQUIRED_ARGUMENT, NULL, VIEW_FILE_IDX},
+  {"kernel", CUTIL_OPTION_REQUIRED_ARGUMENT, NULL, KERNEL_IDX},
+  {"fill", CUTIL_OPTION_REQUIRED_ARGUMENT, NULL, FILL_IDX},
   {0, 0, 0, 0},
 };
 
@@ -81,7 +85,11 @@ static const char *const USAGE
     "      --palette_idx   Sets start index for colour palette\n"
     "      --trip_mode     Sets \"trip mode\" type\n"
     "      --view_file     Sets name of file to save view to (relative to "
-    "env)\n";
+    "env)\n"
+    "      --kernel        Sets arithmetic kernel for iterations (\"auto\" "
+    "for automatic choice)\n"
+    "      --fill          Sets filling of chunks (\"off\", \"border\", "
+    "\"interval\" or \"verify\")\n";
 
 /**
  * Auxiliary struct for environment strings (path and file names)
@@ -219,6 +227,12 @@ _get_settings(const struct _env *env, int argc, char **argv)
         case VIEW_FILE_IDX: /* view_file */
             settings->view_file = cutil_strdup(cutil_optarg);
             break;
+        case KERNEL_IDX: /* kernel */
+            settings->kernel = cutil_strdup(cutil_optarg);
+            break;
+        case FILL_IDX: /* fill */
+            settings->fill = cutil_strdup(cutil_optarg);
+            break;
         default: /* anything else has been handled before */
             break;
         }
@@ -0,0 +1,87 @@
+#include <util/cpu.h>
+
+#include <cutil/std/stdbool.h>
+
+#if CPU_DISPATCH && defined(_MSC_VER)
+    #include <immintrin.h>
+    #include <intrin.h>
+
+    /* Bits of CPUID leaves 1 (ecx) and 7 (ebx) */
+    #define CPUID_OSXSAVE_BIT (1 << 27)
+    #define CPUID_AVX2_BIT (1 << 5)
+    #define CPUID_AVX512F_BIT (1 << 16)
+
+    /* Register states the operating system has to save (XCR0) */
+    #define XCR0_AVX_STATE 0x06ULL
+    #define XCR0_AVX512_STATE 0xE6ULL
+
+static enum CpuIsa
+_cpu_detect_isa_cpuid(void)
+{
+    int info[4] = {0};
+    __cpuid(info, 0);
+    const int max_leaf = info[0];
+    if (max_leaf < 7) {
+        return CPU_ISA_BASELINE;
+    }
+
+    __cpuid(info, 1);
+    if (!(info[2] & CPUID_OSXSAVE_BIT)) {
+        return CPU_ISA_BASELINE;
+    }
+    const unsigned long long xcr0 = _xgetbv(0);
+
+    __cpuidex(info, 7, 0);
+    const bool has_avx512
+      = (info[1] & CPUID_AVX512F_BIT)
+        && ((xcr0 & XCR0_AVX512_STATE) == XCR0_AVX512_STATE);
+    if (has_avx512) {
+        return CPU_ISA_AVX512;
+    }
+    const bool has_avx2 = (info[1] & CPUID_AVX2_BIT)
+                          && ((xcr0 & XCR0_AVX_STATE) == XCR0_AVX_STATE);
+    if (has_avx2) {
+        return CPU_ISA_AVX2;
+    }
+    return CPU_ISA_BASELINE;
+}
+
+#endif
+
+enum CpuIsa
+Cpu_detect_isa(void)
+{
+#if CPU_DISPATCH && defined(_MSC_VER)
+    return _cpu_detect_isa_cpuid();
+#elif CPU_DISPATCH
+    /* Also checks whether the operating system saves the vector registers */
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return CPU_ISA_AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return CPU_ISA_AVX2;
+    }
+    return CPU_ISA_BASELINE;
+#elif defined(__AVX512F__)
+    return CPU_ISA_AVX512;
+#elif defined(__AVX2__)
+    return CPU_ISA_AVX2;
+#else
+    return CPU_ISA_BASELINE;
+#endif
+}
+
+const char *
+Cpu_get_isa_name(enum CpuIsa isa)
+{
+    switch (isa) {
+    case CPU_ISA_AVX512:
+        return "AVX-512";
+    case CPU_ISA_AVX2:
+        return "AVX2";
+    case CPU_ISA_BASELINE:
+    default:
+        return "baseline";
+    }
+}
@@ -0,0 +1,73 @@
+/* util/cpu.h
+ *
+ * Header for runtime detection of CPU features
+ *
+ */
+
+#ifndef MANDELBROT_UTIL_CPU_H_INCLUDED
+#define MANDELBROT_UTIL_CPU_H_INCLUDED
+
+/**
+ * Variants of hot kernels are compiled for several instruction sets and chosen
+ * at runtime on x86 with GCC, Clang and MSVC. Elsewhere, only the instruction
+ * sets enabled at compile time are used.
+ */
+#if (defined(__GNUC__) || defined(__clang__))                                  \
+  && (defined(__x86_64__) || defined(__i386__))
+    #define CPU_DISPATCH 1
+    #define CPU_TARGET_AVX2 __attribute__((target("avx2")))
+    #define CPU_TARGET_AVX512 __attribute__((target("avx512f")))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #define CPU_DISPATCH 1
+    #define CPU_TARGET_AVX2
+    #define CPU_TARGET_AVX512
+#else
+    #define CPU_DISPATCH 0
+    #define CPU_TARGET_AVX2
+    #define CPU_TARGET_AVX512
+#endif
+
+/**
+ * Whether variants for the respective instruction sets can be compiled
+ */
+#if CPU_DISPATCH || defined(__AVX2__)
+    #define CPU_HAVE_AVX2 1
+#else
+    #define CPU_HAVE_AVX2 0
+#endif
+#if CPU_DISPATCH || defined(__AVX512F__)
+    #define CPU_HAVE_AVX512 1
+#else
+    #define CPU_HAVE_AVX512 0
+#endif
+
+/**
+ * Instruction sets that kernels are specialized for
+ */
+enum CpuIsa {
+    CPU_ISA_BASELINE = 0,
+    CPU_ISA_AVX2,
+    CPU_ISA_AVX512,
+};
+
+/**
+ * Returns the most capable instruction set that is supported by both the CPU
+ * and the operating system. Without CPU_DISPATCH, this is the instruction set
+ * enabled at compile time.
+ *
+ * @return most capable supported instruction set
+ */
+enum CpuIsa
+Cpu_detect_isa(void);
+
+/**
+ * Returns the name of `isa` (for logging).
+ *
+ * @param[in] isa instruction set to get name of
+ *
+ * @return name of `isa`
+ */
+const char *
+Cpu_get_isa_name(enum CpuIsa isa);
+
+#endif /* MANDELBROT_UTIL_CPU_H_INCLUDED */
@@ -0,0 +1,30 @@
+#include <util/floatexp.h>
+
+extern inline FloatExp
+FloatExp_normalize(double mant, long exp);
+
+extern inline FloatExp
+FloatExp_from_double(double d);
+
+extern inline double
+FloatExp_to_double(FloatExp x);
+
+extern inline FloatExp
+FloatExp_add(FloatExp a, FloatExp b);
+
+extern inline FloatExp
+FloatExp_sub(FloatExp a, FloatExp b);
+
+extern inline FloatExp
+FloatExp_mul(FloatExp a, FloatExp b);
+
+extern inline FloatExp
+FloatExp_mul_d(FloatExp a, double d);
+
+FloatExp
+FloatExp_from_mpf(mpf_srcptr x)
+{
+    long int exp = 0;
+    const double mant = mpf_get_d_2exp(&exp, x);
+    return FloatExp_normalize(mant, exp);
+}
@@ -0,0 +1,167 @@
+/* util/floatexp.h
+ *
+ * Header for floating-point numbers with extended exponent range
+ *
+ */
+
+#ifndef MANDELBROT_UTIL_FLOATEXP_H_INCLUDED
+#define MANDELBROT_UTIL_FLOATEXP_H_INCLUDED
+
+#include <limits.h>
+
+#include <gmp.h>
+
+#include <cutil/std/math.h>
+
+/**
+ * Floating-point number with a double mantissa and a separate exponent, i.e.,
+ * mant * 2^exp. Normalized numbers have 0.5 <= |mant| < 1 or are zero with a
+ * zero exponent. This allows for numbers far below the range of double, e.g.,
+ * for the differences of pixels at very deep zooms.
+ */
+typedef struct {
+    double mant; /* Mantissa */
+    long exp;    /* Exponent to base 2 */
+} FloatExp;
+
+/**
+ * Exponent difference beyond which the smaller summand has no effect
+ */
+#define FLOATEXP_MAX_EXP_DIFF 64
+
+/**
+ * Returns normalized version of `mant` * 2^`exp`.
+ *
+ * @param[in] mant mantissa
+ * @param[in] exp exponent to base 2
+ *
+ * @return normalized FloatExp
+ */
+inline FloatExp
+FloatExp_normalize(double mant, long exp)
+{
+    FloatExp res;
+    if (mant == 0.0) {
+        res.mant = 0.0;
+        res.exp = 0L;
+        return res;
+    }
+    int e = 0;
+    res.mant = frexp(mant, &e);
+    res.exp = exp + e;
+    return res;
+}
+
+/**
+ * Converts double `d` to a FloatExp.
+ *
+ * @param[in] d double to convert
+ *
+ * @return FloatExp with the value of `d`
+ */
+inline FloatExp
+FloatExp_from_double(double d)
+{
+    return FloatExp_normalize(d, 0L);
+}
+
+/**
+ * Converts `x` to a double. The result underflows to zero or overflows to
+ * infinity if `x` is out of range.
+ *
+ * @param[in] x FloatExp to convert
+ *
+ * @return double with the value of `x`
+ */
+inline double
+FloatExp_to_double(FloatExp x)
+{
+    if (x.exp < INT_MIN || x.exp > INT_MAX) {
+        return (x.exp < 0L) ? 0.0 * x.mant : HUGE_VAL * x.mant;
+    }
+    return ldexp(x.mant, (int) x.exp);
+}
+
+/**
+ * Returns the sum of `a` and `b`.
+ *
+ * @param[in] a first summand
+ * @param[in] b second summand
+ *
+ * @return a + b
+ */
+inline FloatExp
+FloatExp_add(FloatExp a, FloatExp b)
+{
+    if (a.mant == 0.0) {
+        return b;
+    }
+    if (b.mant == 0.0) {
+        return a;
+    }
+    if (a.exp < b.exp) {
+        const FloatExp tmp = a;
+        a = b;
+        b = tmp;
+    }
+    const long diff = a.exp - b.exp;
+    if (diff > FLOATEXP_MAX_EXP_DIFF) {
+        return a;
+    }
+    return FloatExp_normalize(a.mant + ldexp(b.mant, (int) -diff), a.exp);
+}
+
+/**
+ * Returns the difference of `a` and `b`.
+ *
+ * @param[in] a minuend
+ * @param[in] b subtrahend
+ *
+ * @return a - b
+ */
+inline FloatExp
+FloatExp_sub(FloatExp a, FloatExp b)
+{
+    b.mant = -b.mant;
+    return FloatExp_add(a, b);
+}
+
+/**
+ * Returns the product of `a` and `b`.
+ *
+ * @param[in] a first factor
+ * @param[in] b second factor
+ *
+ * @return a * b
+ */
+inline FloatExp
+FloatExp_mul(FloatExp a, FloatExp b)
+{
+    return FloatExp_normalize(a.mant * b.mant, a.exp + b.exp);
+}
+
+/**
+ * Returns the product of `a` and the double `d`.
+ *
+ * @param[in] a first factor
+ * @param[in] d second factor
+ *
+ * @return a * d
+ */
+inline FloatExp
+FloatExp_mul_d(FloatExp a, double d)
+{
+    return FloatExp_normalize(a.mant * d, a.exp);
+}
+
+/**
+ * Converts GMP floating point number `x` to a FloatExp.
+ *
+ * @param[in] x GMP floating point number to convert
+ *
+ * @return FloatExp with the value of `x` (rounded to double precision)
+ */
+FloatExp
+FloatExp_from_mpf(mpf_srcptr x);
+
+#endif /* MANDELBROT_UTIL_FLOATEXP_H_INCLUDED */
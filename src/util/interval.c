@@ -0,0 +1,25 @@
+#include <util/interval.h>
+
+extern inline Interval
+Interval_round_out(double lo, double hi);
+
+extern inline Interval
+Interval_from_bounds(double lo, double hi);
+
+extern inline Interval
+Interval_add(Interval a, Interval b);
+
+extern inline Interval
+Interval_sub(Interval a, Interval b);
+
+extern inline Interval
+Interval_mul(Interval a, Interval b);
+
+extern inline Interval
+Interval_sqr(Interval a);
+
+extern inline Interval
+Interval_mul_2(Interval a);
+
+extern inline bool
+Interval_is_subset(Interval a, Interval b);
@@ -0,0 +1,165 @@
+/* util/interval.h
+ *
+ * Header for interval arithmetic on doubles
+ *
+ */
+
+#ifndef MANDELBROT_UTIL_INTERVAL_H_INCLUDED
+#define MANDELBROT_UTIL_INTERVAL_H_INCLUDED
+
+#include <float.h>
+
+#include <cutil/std/math.h>
+#include <cutil/std/stdbool.h>
+
+/**
+ * Closed interval [lo, hi] of doubles. All operations round outwards, i.e.,
+ * the result contains the exact result of the operation for all numbers in the
+ * operands. As the rounding mode is not changed, each bound is moved outwards by
+ * at least one ulp after rounding to nearest, which relies on strict IEEE
+ * double arithmetic (no -ffast-math).
+ */
+typedef struct {
+    double lo; /* Lower bound */
+    double hi; /* Upper bound */
+} Interval;
+
+/**
+ * Returns the interval [`lo`, `hi`] moved outwards by at least one ulp at both
+ * bounds, i.e., an enclosure of the exact interval whose bounds have been
+ * rounded to nearest. The relative widening by DBL_EPSILON is cheaper than
+ * `nextafter` and DBL_MIN covers bounds close to zero.
+ *
+ * @param[in] lo lower bound rounded to nearest
+ * @param[in] hi upper bound rounded to nearest
+ *
+ * @return enclosure of [`lo`, `hi`]
+ */
+inline Interval
+Interval_round_out(double lo, double hi)
+{
+    Interval res;
+    res.lo = lo - (fabs(lo) * DBL_EPSILON + DBL_MIN);
+    res.hi = hi + (fabs(hi) * DBL_EPSILON + DBL_MIN);
+    return res;
+}
+
+/**
+ * Returns the interval [`lo`, `hi`], which is exact.
+ *
+ * @param[in] lo lower bound
+ * @param[in] hi upper bound
+ *
+ * @return [`lo`, `hi`]
+ */
+inline Interval
+Interval_from_bounds(double lo, double hi)
+{
+    Interval res;
+    res.lo = lo;
+    res.hi = hi;
+    return res;
+}
+
+/**
+ * Returns an enclosure of the sum of `a` and `b`.
+ *
+ * @param[in] a first summand
+ * @param[in] b second summand
+ *
+ * @return enclosure of a + b
+ */
+inline Interval
+Interval_add(Interval a, Interval b)
+{
+    return Interval_round_out(a.lo + b.lo, a.hi + b.hi);
+}
+
+/**
+ * Returns an enclosure of the difference of `a` and `b`.
+ *
+ * @param[in] a minuend
+ * @param[in] b subtrahend
+ *
+ * @return enclosure of a - b
+ */
+inline Interval
+Interval_sub(Interval a, Interval b)
+{
+    return Interval_round_out(a.lo - b.hi, a.hi - b.lo);
+}
+
+/**
+ * Returns an enclosure of the product of `a` and `b`.
+ *
+ * @param[in] a first factor
+ * @param[in] b second factor
+ *
+ * @return enclosure of a * b
+ */
+inline Interval
+Interval_mul(Interval a, Interval b)
+{
+    const double p1 = a.lo * b.lo;
+    const double p2 = a.lo * b.hi;
+    const double p3 = a.hi * b.lo;
+    const double p4 = a.hi * b.hi;
+    const double min_12 = (p1 < p2) ? p1 : p2;
+    const double min_34 = (p3 < p4) ? p3 : p4;
+    const double max_12 = (p1 > p2) ? p1 : p2;
+    const double max_34 = (p3 > p4) ? p3 : p4;
+    return Interval_round_out(
+      (min_12 < min_34) ? min_12 : min_34, (max_12 > max_34) ? max_12 : max_34
+    );
+}
+
+/**
+ * Returns an enclosure of the square of `a`, which is tighter than the product
+ * of `a` with itself if `a` contains zero.
+ *
+ * @param[in] a interval to square
+ *
+ * @return enclosure of a^2
+ */
+inline Interval
+Interval_sqr(Interval a)
+{
+    const double lo_sqr = a.lo * a.lo;
+    const double hi_sqr = a.hi * a.hi;
+    if (a.lo >= 0.0) {
+        return Interval_round_out(lo_sqr, hi_sqr);
+    }
+    if (a.hi <= 0.0) {
+        return Interval_round_out(hi_sqr, lo_sqr);
+    }
+    return Interval_round_out(0.0, (lo_sqr > hi_sqr) ? lo_sqr : hi_sqr);
+}
+
+/**
+ * Returns the product of `a` and 2, which is exact (barring overflow).
+ *
+ * @param[in] a interval to double
+ *
+ * @return 2 * a
+ */
+inline Interval
+Interval_mul_2(Interval a)
+{
+    return Interval_from_bounds(2.0 * a.lo, 2.0 * a.hi);
+}
+
+/**
+ * Returns whether `a` is contained in `b`.
+ *
+ * @param[in] a interval to check
+ * @param[in] b interval to check against
+ *
+ * @return whether `a` is a subset of `b`
+ */
+inline bool
+Interval_is_subset(Interval a, Interval b)
+{
+    return (a.lo >= b.lo && a.hi <= b.hi);
+}
+
+#endif /* MANDELBROT_UTIL_INTERVAL_H_INCLUDED */
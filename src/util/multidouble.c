@@ -0,0 +1,93 @@
+#include <util/multidouble.h>
+
+extern inline double
+MultiDouble_quick_two_sum(double a, double b, double *err);
+
+extern inline double
+MultiDouble_two_sum(double a, double b, double *err);
+
+extern inline double
+MultiDouble_two_prod(double a, double b, double *err);
+
+extern inline void
+MultiDouble_three_sum(double *a, double *b, double *c);
+
+extern inline void
+MultiDouble_three_sum2(double *a, double *b, double c);
+
+extern inline DoubleDouble
+DoubleDouble_from_double(double d);
+
+extern inline DoubleDouble
+DoubleDouble_add(DoubleDouble a, DoubleDouble b);
+
+extern inline DoubleDouble
+DoubleDouble_sub(DoubleDouble a, DoubleDouble b);
+
+extern inline DoubleDouble
+DoubleDouble_mul(DoubleDouble a, DoubleDouble b);
+
+extern inline DoubleDouble
+DoubleDouble_sqr(DoubleDouble a);
+
+extern inline DoubleDouble
+DoubleDouble_mul_d(DoubleDouble a, double d);
+
+extern inline QuadDouble
+QuadDouble_from_double(double d);
+
+extern inline QuadDouble
+QuadDouble_renormalize(double c0, double c1, double c2, double c3, double c4);
+
+extern inline QuadDouble
+QuadDouble_add(QuadDouble a, QuadDouble b);
+
+extern inline QuadDouble
+QuadDouble_sub(QuadDouble a, QuadDouble b);
+
+extern inline QuadDouble
+QuadDouble_mul(QuadDouble a, QuadDouble b);
+
+extern inline QuadDouble
+QuadDouble_mul_d(QuadDouble a, double d);
+
+/**
+ * Writes the leading `num` doubles of `x` to `res` by repeatedly subtracting
+ * the truncated leading part.
+ */
+static void
+_multiDouble_split_mpf(mpf_srcptr x, double *res, int num)
+{
+    mpf_t rem, part;
+    mpf_init2(rem, mpf_get_prec(x));
+    mpf_init2(part, mpf_get_prec(x));
+
+    mpf_set(rem, x);
+    for (int i = 0; i < num; ++i) {
+        res[i] = mpf_get_d(rem);
+        mpf_set_d(part, res[i]);
+        mpf_sub(rem, rem, part);
+    }
+
+    mpf_clear(rem);
+    mpf_clear(part);
+}
+
+DoubleDouble
+DoubleDouble_from_mpf(mpf_srcptr x)
+{
+    double c[2];
+    _multiDouble_split_mpf(x, c, 2);
+
+    DoubleDouble res;
+    res.hi = MultiDouble_quick_two_sum(c[0], c[1], &res.lo);
+    return res;
+}
+
+QuadDouble
+QuadDouble_from_mpf(mpf_srcptr x)
+{
+    double c[4];
+    _multiDouble_split_mpf(x, c, 4);
+    return QuadDouble_renormalize(c[0], c[1], c[2], c[3], 0.0);
+}
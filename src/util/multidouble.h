@@ -0,0 +1,454 @@
+/* util/multidouble.h
+ *
+ * Header for double-double and quad-double numbers
+ *
+ */
+
+#ifndef MANDELBROT_UTIL_MULTIDOUBLE_H_INCLUDED
+#define MANDELBROT_UTIL_MULTIDOUBLE_H_INCLUDED
+
+#include <gmp.h>
+
+#include <cutil/std/math.h>
+
+/**
+ * Unevaluated sum hi + lo of two doubles with |lo| <= ulp(hi) / 2, i.e., a
+ * floating-point number with a mantissa of about 106 bits but the exponent
+ * range of double. All operations are built on error-free transformations and
+ * rely on strict IEEE double arithmetic (no -ffast-math).
+ */
+typedef struct {
+    double hi; /* Leading component */
+    double lo; /* Trailing component */
+} DoubleDouble;
+
+/**
+ * Unevaluated sum of four non-overlapping doubles (in order of decreasing
+ * magnitude), i.e., a floating-point number with a mantissa of about 212 bits
+ * but the exponent range of double.
+ */
+typedef struct {
+    double x[4]; /* Components in order of decreasing magnitude */
+} QuadDouble;
+
+/* Splitter for Dekker's product, 2^ceil(DBL_MANT_DIG / 2) + 1 */
+#define MULTIDOUBLE_SPLITTER 134217729.0
+
+/**
+ * Returns s = fl(`a` + `b`) and writes the rounding error to `err`, i.e.,
+ * s + err = a + b exactly. Requires |`a`| >= |`b`|.
+ */
+inline double
+MultiDouble_quick_two_sum(double a, double b, double *err)
+{
+    const double s = a + b;
+    *err = b - (s - a);
+    return s;
+}
+
+/**
+ * Returns s = fl(`a` + `b`) and writes the rounding error to `err`, i.e.,
+ * s + err = a + b exactly.
+ */
+inline double
+MultiDouble_two_sum(double a, double b, double *err)
+{
+    const double s = a + b;
+    const double bb = s - a;
+    *err = (a - (s - bb)) + (b - bb);
+    return s;
+}
+
+/**
+ * Returns p = fl(`a` * `b`) and writes the rounding error to `err`, i.e.,
+ * p + err = a * b exactly. Uses fused multiply-add if it is fast and Dekker's
+ * product otherwise.
+ */
+inline double
+MultiDouble_two_prod(double a, double b, double *err)
+{
+    const double p = a * b;
+#ifdef FP_FAST_FMA
+    *err = fma(a, b, -p);
+#else
+    const double ta = MULTIDOUBLE_SPLITTER * a;
+    const double a_hi = ta - (ta - a);
+    const double a_lo = a - a_hi;
+    const double tb = MULTIDOUBLE_SPLITTER * b;
+    const double b_hi = tb - (tb - b);
+    const double b_lo = b - b_hi;
+    *err = ((a_hi * b_hi - p) + a_hi * b_lo + a_lo * b_hi) + a_lo * b_lo;
+#endif
+    return p;
+}
+
+/**
+ * Converts double `d` to a DoubleDouble.
+ *
+ * @param[in] d double to convert
+ *
+ * @return DoubleDouble with the value of `d`
+ */
+inline DoubleDouble
+DoubleDouble_from_double(double d)
+{
+    const DoubleDouble res = {d, 0.0};
+    return res;
+}
+
+/**
+ * Returns the sum of `a` and `b`.
+ *
+ * @param[in] a first summand
+ * @param[in] b second summand
+ *
+ * @return a + b
+ */
+inline DoubleDouble
+DoubleDouble_add(DoubleDouble a, DoubleDouble b)
+{
+    double s2 = 0.0;
+    double t2 = 0.0;
+    double s1 = MultiDouble_two_sum(a.hi, b.hi, &s2);
+    const double t1 = MultiDouble_two_sum(a.lo, b.lo, &t2);
+    s2 += t1;
+    s1 = MultiDouble_quick_two_sum(s1, s2, &s2);
+    s2 += t2;
+
+    DoubleDouble res;
+    res.hi = MultiDouble_quick_two_sum(s1, s2, &res.lo);
+    return res;
+}
+
+/**
+ * Returns the difference of `a` and `b`.
+ *
+ * @param[in] a minuend
+ * @param[in] b subtrahend
+ *
+ * @return a - b
+ */
+inline DoubleDouble
+DoubleDouble_sub(DoubleDouble a, DoubleDouble b)
+{
+    b.hi = -b.hi;
+    b.lo = -b.lo;
+    return DoubleDouble_add(a, b);
+}
+
+/**
+ * Returns the product of `a` and `b`.
+ *
+ * @param[in] a first factor
+ * @param[in] b second factor
+ *
+ * @return a * b
+ */
+inline DoubleDouble
+DoubleDouble_mul(DoubleDouble a, DoubleDouble b)
+{
+    double p2 = 0.0;
+    const double p1 = MultiDouble_two_prod(a.hi, b.hi, &p2);
+    p2 += a.hi * b.lo + a.lo * b.hi;
+
+    DoubleDouble res;
+    res.hi = MultiDouble_quick_two_sum(p1, p2, &res.lo);
+    return res;
+}
+
+/**
+ * Returns the square of `a`, which is cheaper than `DoubleDouble_mul`.
+ *
+ * @param[in] a number to square
+ *
+ * @return a * a
+ */
+inline DoubleDouble
+DoubleDouble_sqr(DoubleDouble a)
+{
+    double p2 = 0.0;
+    const double p1 = MultiDouble_two_prod(a.hi, a.hi, &p2);
+    p2 += 2.0 * a.hi * a.lo;
+    p2 += a.lo * a.lo;
+
+    DoubleDouble res;
+    res.hi = MultiDouble_quick_two_sum(p1, p2, &res.lo);
+    return res;
+}
+
+/**
+ * Returns the product of `a` and the double `d`.
+ *
+ * @param[in] a first factor
+ * @param[in] d second factor
+ *
+ * @return a * d
+ */
+inline DoubleDouble
+DoubleDouble_mul_d(DoubleDouble a, double d)
+{
+    double p2 = 0.0;
+    const double p1 = MultiDouble_two_prod(a.hi, d, &p2);
+    p2 += a.lo * d;
+
+    DoubleDouble res;
+    res.hi = MultiDouble_quick_two_sum(p1, p2, &res.lo);
+    return res;
+}
+
+/**
+ * Converts GMP floating point number `x` to a DoubleDouble.
+ *
+ * @param[in] x GMP floating point number to convert
+ *
+ * @return DoubleDouble with the value of `x` (truncated to about 106 bits)
+ */
+DoubleDouble
+DoubleDouble_from_mpf(mpf_srcptr x);
+
+/**
+ * Converts double `d` to a QuadDouble.
+ *
+ * @param[in] d double to convert
+ *
+ * @return QuadDouble with the value of `d`
+ */
+inline QuadDouble
+QuadDouble_from_double(double d)
+{
+    const QuadDouble res = {{d, 0.0, 0.0, 0.0}};
+    return res;
+}
+
+/**
+ * Computes the sum of `a`, `b` and `c` in place, i.e., afterwards `a` holds the
+ * rounded sum and `b` and `c` hold the first and second error terms.
+ */
+inline void
+MultiDouble_three_sum(double *a, double *b, double *c)
+{
+    double t2 = 0.0;
+    double t3 = 0.0;
+    const double t1 = MultiDouble_two_sum(*a, *b, &t2);
+    *a = MultiDouble_two_sum(*c, t1, &t3);
+    *b = MultiDouble_two_sum(t2, t3, c);
+}
+
+/**
+ * Computes the sum of `a`, `b` and `c` in place like `MultiDouble_three_sum`,
+ * but only keeps the first error term in `b`.
+ */
+inline void
+MultiDouble_three_sum2(double *a, double *b, double c)
+{
+    double t2 = 0.0;
+    double t3 = 0.0;
+    const double t1 = MultiDouble_two_sum(*a, *b, &t2);
+    *a = MultiDouble_two_sum(c, t1, &t3);
+    *b = t2 + t3;
+}
+
+/**
+ * Renormalizes the five overlapping components `c0`, ..., `c4` (in order of
+ * decreasing magnitude) into a QuadDouble.
+ *
+ * @param[in] c0 first component
+ * @param[in] c1 second component
+ * @param[in] c2 third component
+ * @param[in] c3 fourth component
+ * @param[in] c4 fifth component
+ *
+ * @return renormalized QuadDouble
+ */
+inline QuadDouble
+QuadDouble_renormalize(double c0, double c1, double c2, double c3, double c4)
+{
+    QuadDouble res = {{0.0, 0.0, 0.0, 0.0}};
+    if (isinf(c0)) {
+        res.x[0] = c0;
+        return res;
+    }
+
+    double s0 = MultiDouble_quick_two_sum(c3, c4, &c4);
+    s0 = MultiDouble_quick_two_sum(c2, s0, &c3);
+    s0 = MultiDouble_quick_two_sum(c1, s0, &c2);
+    c0 = MultiDouble_quick_two_sum(c0, s0, &c1);
+
+    /* Accumulate the remaining components into non-overlapping ones */
+    s0 = c0;
+    double s1 = c1;
+    double s2 = 0.0;
+    double s3 = 0.0;
+    if (s1 != 0.0) {
+        s1 = MultiDouble_quick_two_sum(s1, c2, &s2);
+        if (s2 != 0.0) {
+            s2 = MultiDouble_quick_two_sum(s2, c3, &s3);
+            if (s3 != 0.0) {
+                s3 += c4;
+            } else {
+                s2 += c4;
+            }
+        } else {
+            s1 = MultiDouble_quick_two_sum(s1, c3, &s2);
+            if (s2 != 0.0) {
+                s2 = MultiDouble_quick_two_sum(s2, c4, &s3);
+            } else {
+                s1 = MultiDouble_quick_two_sum(s1, c4, &s2);
+            }
+        }
+    } else {
+        s0 = MultiDouble_quick_two_sum(s0, c2, &s1);
+        if (s1 != 0.0) {
+            s1 = MultiDouble_quick_two_sum(s1, c3, &s2);
+            if (s2 != 0.0) {
+                s2 = MultiDouble_quick_two_sum(s2, c4, &s3);
+            } else {
+                s1 = MultiDouble_quick_two_sum(s1, c4, &s2);
+            }
+        } else {
+            s0 = MultiDouble_quick_two_sum(s0, c3, &s1);
+            if (s1 != 0.0) {
+                s1 = MultiDouble_quick_two_sum(s1, c4, &s2);
+            } else {
+                s0 = MultiDouble_quick_two_sum(s0, c4, &s1);
+            }
+        }
+    }
+
+    res.x[0] = s0;
+    res.x[1] = s1;
+    res.x[2] = s2;
+    res.x[3] = s3;
+    return res;
+}
+
+/**
+ * Returns the sum of `a` and `b`. The error is bounded relative to the larger
+ * summand rather than to the sum (no IEEE-style error bound), which suffices
+ * as long as the magnitudes of all numbers involved are comparable.
+ *
+ * @param[in] a first summand
+ * @param[in] b second summand
+ *
+ * @return a + b
+ */
+inline QuadDouble
+QuadDouble_add(QuadDouble a, QuadDouble b)
+{
+    double t0 = 0.0;
+    double t1 = 0.0;
+    double t2 = 0.0;
+    double t3 = 0.0;
+    const double s0 = MultiDouble_two_sum(a.x[0], b.x[0], &t0);
+    double s1 = MultiDouble_two_sum(a.x[1], b.x[1], &t1);
+    double s2 = MultiDouble_two_sum(a.x[2], b.x[2], &t2);
+    double s3 = MultiDouble_two_sum(a.x[3], b.x[3], &t3);
+
+    s1 = MultiDouble_two_sum(s1, t0, &t0);
+    MultiDouble_three_sum(&s2, &t0, &t1);
+    MultiDouble_three_sum2(&s3, &t0, t2);
+    t0 = t0 + t1 + t3;
+
+    return QuadDouble_renormalize(s0, s1, s2, s3, t0);
+}
+
+/**
+ * Returns the difference of `a` and `b`.
+ *
+ * @param[in] a minuend
+ * @param[in] b subtrahend
+ *
+ * @return a - b
+ */
+inline QuadDouble
+QuadDouble_sub(QuadDouble a, QuadDouble b)
+{
+    for (int i = 0; i < 4; ++i) {
+        b.x[i] = -b.x[i];
+    }
+    return QuadDouble_add(a, b);
+}
+
+/**
+ * Returns the product of `a` and `b`.
+ *
+ * @param[in] a first factor
+ * @param[in] b second factor
+ *
+ * @return a * b
+ */
+inline QuadDouble
+QuadDouble_mul(QuadDouble a, QuadDouble b)
+{
+    double q0 = 0.0;
+    double q1 = 0.0;
+    double q2 = 0.0;
+    double q3 = 0.0;
+    double q4 = 0.0;
+    double q5 = 0.0;
+    const double p0 = MultiDouble_two_prod(a.x[0], b.x[0], &q0);
+    double p1 = MultiDouble_two_prod(a.x[0], b.x[1], &q1);
+    double p2 = MultiDouble_two_prod(a.x[1], b.x[0], &q2);
+    double p3 = MultiDouble_two_prod(a.x[0], b.x[2], &q3);
+    double p4 = MultiDouble_two_prod(a.x[1], b.x[1], &q4);
+    double p5 = MultiDouble_two_prod(a.x[2], b.x[0], &q5);
+
+    /* Terms of order eps^1 */
+    MultiDouble_three_sum(&p1, &p2, &q0);
+
+    /* Terms of order eps^2: (p2, q1, q2) + (p3, p4, p5) */
+    MultiDouble_three_sum(&p2, &q1, &q2);
+    MultiDouble_three_sum(&p3, &p4, &p5);
+    double t0 = 0.0;
+    double t1 = 0.0;
+    const double s0 = MultiDouble_two_sum(p2, p3, &t0);
+    double s1 = MultiDouble_two_sum(q1, p4, &t1);
+    double s2 = q2 + p5;
+    s1 = MultiDouble_two_sum(s1, t0, &t0);
+    s2 += (t0 + t1);
+
+    /* Terms of order eps^3 */
+    s1 += a.x[0] * b.x[3] + a.x[1] * b.x[2] + a.x[2] * b.x[1]
+          + a.x[3] * b.x[0] + q0 + q3 + q4 + q5;
+
+    return QuadDouble_renormalize(p0, p1, s0, s1, s2);
+}
+
+/**
+ * Returns the product of `a` and the double `d`.
+ *
+ * @param[in] a first factor
+ * @param[in] d second factor
+ *
+ * @return a * d
+ */
+inline QuadDouble
+QuadDouble_mul_d(QuadDouble a, double d)
+{
+    double q0 = 0.0;
+    double q1 = 0.0;
+    double q2 = 0.0;
+    double s2 = 0.0;
+    const double p0 = MultiDouble_two_prod(a.x[0], d, &q0);
+    const double p1 = MultiDouble_two_prod(a.x[1], d, &q1);
+    double p2 = MultiDouble_two_prod(a.x[2], d, &q2);
+    const double p3 = a.x[3] * d;
+
+    const double s1 = MultiDouble_two_sum(q0, p1, &s2);
+    MultiDouble_three_sum(&s2, &q1, &p2);
+    MultiDouble_three_sum2(&q1, &q2, p3);
+
+    return QuadDouble_renormalize(p0, s1, s2, q1, q2 + p2);
+}
+
+/**
+ * Converts GMP floating point number `x` to a QuadDouble.
+ *
+ * @param[in] x GMP floating point number to convert
+ *
+ * @return QuadDouble with the value of `x` (truncated to about 212 bits)
+ */
+QuadDouble
+QuadDouble_from_mpf(mpf_srcptr x);
+
+#endif /* MANDELBROT_UTIL_MULTIDOUBLE_H_INCLUDED */
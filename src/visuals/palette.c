@@ -125,6 +125,89 @@ Palette_ultra_fractal(float pos, const void *params)
     );
 }
 
+/**
+ * Loop of `Palette_map` for palette function `FNC`
+ */
+#define PALETTE_MAP_LOOP(FNC)                                                  \
+    do {                                                                       \
+        for (int idx = 0; idx < num; ++idx) {                                  \
+            res[idx * stride] = FNC(pos[idx], params);                         \
+        }                                                                      \
+    } while (0)
+
+/**
+ * Defines variant `NAME` of `Palette_map` with target attribute `TARGET`. The
+ * built-in palettes are called directly, so that they can be inlined and
+ * compiled for the instruction set of the variant.
+ */
+#define PALETTE_MAP_DEFINE(NAME, TARGET)                                       \
+    TARGET static void NAME(                                                   \
+      Palette_fnc *palette, const void *params, const float *pos, int num,     \
+      uint32_t *res, int stride                                                \
+    )                                                                          \
+    {                                                                          \
+        if (palette == &Palette_gray) {                                        \
+            PALETTE_MAP_LOOP(Palette_gray);                                    \
+        } else if (palette == &Palette_red) {                                  \
+            PALETTE_MAP_LOOP(Palette_red);                                     \
+        } else if (palette == &Palette_green) {                                \
+            PALETTE_MAP_LOOP(Palette_green);                                   \
+        } else if (palette == &Palette_blue) {                                 \
+            PALETTE_MAP_LOOP(Palette_blue);                                    \
+        } else if (palette == &Palette_exp_hsv) {                              \
+            PALETTE_MAP_LOOP(Palette_exp_hsv);                                 \
+        } else if (palette == &Palette_ultra_fractal) {                        \
+            PALETTE_MAP_LOOP(Palette_ultra_fractal);                           \
+        } else {                                                               \
+            PALETTE_MAP_LOOP(palette);                                         \
+        }                                                                      \
+    }
+
+PALETTE_MAP_DEFINE(_palette_map_baseline, )
+#if CPU_HAVE_AVX2
+PALETTE_MAP_DEFINE(_palette_map_avx2, CPU_TARGET_AVX2)
+#endif
+#if CPU_HAVE_AVX512
+PALETTE_MAP_DEFINE(_palette_map_avx512, CPU_TARGET_AVX512)
+#endif
+
+typedef void PaletteMap_fnc(
+  Palette_fnc *palette, const void *params, const float *pos, int num,
+  uint32_t *res, int stride
+);
+
+/* Variant of `Palette_map` in use */
+static PaletteMap_fnc *_palette_map = &_palette_map_baseline;
+
+enum CpuIsa
+Palette_select_isa(enum CpuIsa isa)
+{
+#if CPU_HAVE_AVX512
+    if (isa >= CPU_ISA_AVX512) {
+        _palette_map = &_palette_map_avx512;
+        return CPU_ISA_AVX512;
+    }
+#endif
+#if CPU_HAVE_AVX2
+    if (isa >= CPU_ISA_AVX2) {
+        _palette_map = &_palette_map_avx2;
+        return CPU_ISA_AVX2;
+    }
+#endif
+    CUTIL_UNUSED(isa);
+    _palette_map = &_palette_map_baseline;
+    return CPU_ISA_BASELINE;
+}
+
+void
+Palette_map(
+  Palette_fnc *palette, const void *params, const float *pos, int num,
+  uint32_t *res, int stride
+)
+{
+    _palette_map(palette, params, pos, num, res, stride);
+}
+
 struct PaletteCycler {
     size_t num;
     Palette_fnc **fncs;
@@ -10,6 +10,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <util/cpu.h>
+
 #define PALETTE_INVALID_POS -1.0f
 
 /**
@@ -112,6 +114,37 @@ extern Palette_fnc *const PALETTE_FUNCTIONS[];
  */
 extern const size_t PALETTE_FUNCTION_COUNT;
 
+/**
+ * Selects the variant of `Palette_map`, i.e., the most capable one that does
+ * not exceed `isa` and has been compiled. Should be called before any mapping,
+ * the baseline variant is used until then.
+ *
+ * @param[in] isa most capable instruction set to use
+ *
+ * @return instruction set of the selected variant
+ */
+enum CpuIsa
+Palette_select_isa(enum CpuIsa isa);
+
+/**
+ * Maps the `num` positions in `pos` to colours by `palette` and writes them to
+ * every `stride`-th element of `res`. The palettes in PALETTE_FUNCTIONS are
+ * called directly, so they are compiled for the instruction set of the variant
+ * selected by `Palette_select_isa`.
+ *
+ * @param[in] palette palette function to map positions by
+ * @param[in] params parameters for palette function
+ * @param[in] pos array of positions (fractions of maximum iterations)
+ * @param[in] num number of positions
+ * @param[out] res array to write ARGB colours to
+ * @param[in] stride distance of consecutive colours in `res`
+ */
+void
+Palette_map(
+  Palette_fnc *palette, const void *params, const float *pos, int num,
+  uint32_t *res, int stride
+);
+
 /**
  * Opaque palette cycler object
  */
@@ -16,6 +16,8 @@ _should_returnCorrectCooldown_when_provideKey(void)
     TEST_ASSERT_EQUAL_UINT(500U, Key_get_cooldown(KEY_RESET));
     TEST_ASSERT_EQUAL_UINT(500U, Key_get_cooldown(KEY_VIEW_SAVE));
     TEST_ASSERT_EQUAL_UINT(500U, Key_get_cooldown(KEY_VIEW_LOAD));
+    TEST_ASSERT_EQUAL_UINT(500U, Key_get_cooldown(KEY_TOGGLE_BLA));
+    TEST_ASSERT_EQUAL_UINT(500U, Key_get_cooldown(KEY_SNAP_NUCLEUS));
 
     TEST_ASSERT_EQUAL_UINT(0U, Key_get_cooldown(KEY_QUIT));
     TEST_ASSERT_EQUAL_UINT(0U, Key_get_cooldown(KEY_TRIP_MODE));
@@ -59,6 +61,8 @@ _should_returnCorrectKeys_when_provideDefaultKeymap(void)
 
     TEST_ASSERT_EQUAL_INT(KEY_VIEW_SAVE, KeyMap_map(map, SDLK_F5));
     TEST_ASSERT_EQUAL_INT(KEY_VIEW_LOAD, KeyMap_map(map, SDLK_F9));
+    TEST_ASSERT_EQUAL_INT(KEY_TOGGLE_BLA, KeyMap_map(map, SDLK_b));
+    TEST_ASSERT_EQUAL_INT(KEY_SNAP_NUCLEUS, KeyMap_map(map, SDLK_m));
     TEST_ASSERT_EQUAL_INT(KEY_CHANGE_PALETTE, KeyMap_map(map, SDLK_c));
     TEST_ASSERT_EQUAL_INT(KEY_TRIP_MODE, KeyMap_map(map, SDLK_t));
 
@@ -88,6 +92,12 @@ _should_returnCorrectCategory_when_provideKey(void)
     TEST_ASSERT_EQUAL_UINT(
       KEYCATEGORY_DATA, KeyCategory_categorize(KEY_VIEW_LOAD)
     );
+    TEST_ASSERT_EQUAL_UINT(
+      KEYCATEGORY_DATA, KeyCategory_categorize(KEY_TOGGLE_BLA)
+    );
+    TEST_ASSERT_EQUAL_UINT(
+      KEYCATEGORY_DATA, KeyCategory_categorize(KEY_SNAP_NUCLEUS)
+    );
 
     TEST_ASSERT_EQUAL_UINT(KEYCATEGORY_VIDEO, KeyCategory_categorize(KEY_QUIT));
     TEST_ASSERT_EQUAL_UINT(
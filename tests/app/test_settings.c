@@ -17,6 +17,8 @@ static const Settings ASSERT_SETTINGS_2 = {
   .palette_idx = 11,
   .trip_mode = 12,
   .view_file = "13",
+  .kernel = "14",
+  .fill = "15",
 };
 static const Settings ASSERT_SETTINGS_3 = {
   .width = 1,
@@ -30,12 +32,14 @@ static const Settings ASSERT_SETTINGS_3 = {
 static const char *const SETTINGS_DEFAULT_JSON
   = "{\"width\":800,\"height\":600,\"max_re\":1,\"min_re\":-2,\"cntr_im\":0,"
     "\"max_itrs\":500,\"num_chnks_re\":20,\"num_chnks_im\":20,\"zoom_fac\":0.5,"
-    "\"fps\":30,\"palette_idx\":4,\"trip_mode\":0,\"view_file\":\"view.json\"}";
+    "\"fps\":30,\"palette_idx\":4,\"trip_mode\":0,\"view_file\":\"view.json\","
+    "\"kernel\":\"auto\",\"fill\":\"border\"}";
 static const char *const SETTINGS_1_JSON = "{}";
 static const char *const SETTINGS_2_JSON
   = "{\"width\":1,\"height\":2,\"max_re\":4,\"min_re\":3,\"cntr_im\":5,\"max_"
     "itrs\":4,\"num_chnks_re\":7,\"num_chnks_im\":8,\"zoom_fac\":9,\"fps\":10,"
-    "\"palette_idx\":11,\"trip_mode\":12,\"view_file\":\"13\"}";
+    "\"palette_idx\":11,\"trip_mode\":12,\"view_file\":\"13\",\"kernel\":"
+    "\"14\",\"fill\":\"15\"}";
 static const char *const SETTINGS_3_JSON
   = "{\"width\":1,\"max_re\":2,\"min_re\":-1,\"cntr_im\":-3,\"view_file\":"
     "\"test.dat\"}";
@@ -56,6 +60,8 @@ _test_assert_equal_settings(const Settings *lhs, const Settings *rhs)
     TEST_ASSERT_EQUAL_INT(lhs->palette_idx, rhs->palette_idx);
     TEST_ASSERT_EQUAL_INT(lhs->trip_mode, rhs->trip_mode);
     TEST_ASSERT_EQUAL_STRING(lhs->view_file, rhs->view_file);
+    TEST_ASSERT_EQUAL_STRING(lhs->kernel, rhs->kernel);
+    TEST_ASSERT_EQUAL_STRING(lhs->fill, rhs->fill);
 }
 
 static void
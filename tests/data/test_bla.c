@@ -0,0 +1,200 @@
+#include "unity.h"
+
+#include <cutil/std/math.h>
+
+#include <data/bla.h>
+#include <data/orbit.h>
+#include <data/pixel.h>
+
+static void
+_should_haveSingleStepsOnLowestLevel_when_computeTable(void)
+{
+    /* Arrange */
+    const uint16_t max_itrs = 100;
+
+    ReferenceOrbit orbit = {0};
+    BlaTable bla = {0};
+    ReferenceOrbit_init(&orbit);
+    BlaTable_init(&bla);
+
+    mpf_t re, im;
+    mpf_init_set_d(re, -1.0);
+    mpf_init_set_d(im, 0.0);
+
+    ReferenceOrbit_compute(&orbit, re, im, 4.0, max_itrs);
+
+    /* Act */
+    BlaTable_compute(&bla, &orbit, 1e-20);
+
+    /* Assert */
+    TEST_ASSERT_EQUAL_INT(max_itrs, bla.num[0]);
+    for (int k = 1; k < bla.num_levels; ++k) {
+        TEST_ASSERT_EQUAL_INT(bla.num[0] >> k, bla.num[k]);
+    }
+    for (int n = 0; n < bla.num[0]; ++n) {
+        const BlaEntry *const entry = &bla.data[0][n];
+        TEST_ASSERT_EQUAL_DOUBLE(2.0 * orbit.orbit_re[n], entry->a_re);
+        TEST_ASSERT_EQUAL_DOUBLE(2.0 * orbit.orbit_im[n], entry->a_im);
+        TEST_ASSERT_EQUAL_DOUBLE(1.0, entry->b_re);
+        TEST_ASSERT_EQUAL_DOUBLE(0.0, entry->b_im);
+    }
+
+    /* Cleanup */
+    BlaTable_clear(&bla);
+    ReferenceOrbit_clear(&orbit);
+    mpf_clear(re);
+    mpf_clear(im);
+}
+
+static void
+_should_notFindBla_when_differenceIsLarge(void)
+{
+    /* Arrange */
+    ReferenceOrbit orbit = {0};
+    BlaTable bla = {0};
+    ReferenceOrbit_init(&orbit);
+    BlaTable_init(&bla);
+
+    mpf_t re, im;
+    mpf_init_set_d(re, -0.1);
+    mpf_init_set_d(im, 0.1);
+
+    ReferenceOrbit_compute(&orbit, re, im, 4.0, 100);
+    BlaTable_compute(&bla, &orbit, 1e-20);
+
+    int steps = 0;
+
+    /* Act */
+    const BlaEntry *const entry = BlaTable_lookup(&bla, 16, 1.0, 100, &steps);
+
+    /* Assert */
+    TEST_ASSERT_NULL(entry);
+    TEST_ASSERT_EQUAL_INT(0, steps);
+
+    /* Cleanup */
+    BlaTable_clear(&bla);
+    ReferenceOrbit_clear(&orbit);
+    mpf_clear(re);
+    mpf_clear(im);
+}
+
+static void
+_should_skipAlignedBlock_when_differenceIsSmall(void)
+{
+    /* Arrange */
+    ReferenceOrbit orbit = {0};
+    BlaTable bla = {0};
+    ReferenceOrbit_init(&orbit);
+    BlaTable_init(&bla);
+
+    mpf_t re, im;
+    mpf_init_set_d(re, -0.1);
+    mpf_init_set_d(im, 0.1);
+
+    ReferenceOrbit_compute(&orbit, re, im, 4.0, 100);
+    BlaTable_compute(&bla, &orbit, 1e-20);
+
+    int steps = 0;
+
+    /* Act */
+    const BlaEntry *const entry = BlaTable_lookup(&bla, 16, 1e-40, 8, &steps);
+
+    /* Assert */
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_EQUAL_INT(8, steps);
+
+    /* Cleanup */
+    BlaTable_clear(&bla);
+    ReferenceOrbit_clear(&orbit);
+    mpf_clear(re);
+    mpf_clear(im);
+}
+
+static void
+_should_matchPlainPerturbation_when_useBla(void)
+{
+    /* Arrange */
+    enum { NUM = 16 };
+    const mp_bitcnt_t prec = 128UL;
+    const double ref_re = -0.7436438870371587;
+    const double ref_im = 0.1318259042053119;
+    const double upp = 1e-14;
+    const double tol = PixelData_get_tolerance(upp);
+    const uint16_t max_itrs = 5000;
+
+    /* Escape counts may only differ due to the neglected non-linear terms */
+    const int max_mismatches = (NUM * NUM) / 100;
+    const float tolerance = 1.0F / max_itrs;
+    int mismatches = 0;
+
+    ReferenceOrbit orbit = {0};
+    BlaTable bla = {0};
+    PixelData px_plain = {0};
+    PixelData px_bla = {0};
+
+    mpf_set_default_prec(prec);
+
+    mpf_t re, im;
+    mpf_init_set_d(re, ref_re);
+    mpf_init_set_d(im, ref_im);
+
+    ReferenceOrbit_init(&orbit);
+    BlaTable_init(&bla);
+    PixelData_init(&px_plain);
+    PixelData_init(&px_bla);
+
+    ReferenceOrbit_compute(&orbit, re, im, 4.0, max_itrs);
+    BlaTable_compute(&bla, &orbit, hypot(NUM * upp, NUM * upp));
+
+    for (int idx_re = 0; idx_re < NUM; ++idx_re) {
+        for (int idx_im = 0; idx_im < NUM; ++idx_im) {
+            const double dc_re = (idx_re - NUM / 2) * upp;
+            const double dc_im = (idx_im - NUM / 2) * upp;
+
+            /* Act */
+            const bool done_plain = PixelData_iterate_perturbed(
+              &px_plain, &orbit, NULL, dc_re, dc_im, 0, 4.0, tol, max_itrs
+            );
+            const bool done_bla = PixelData_iterate_perturbed(
+              &px_bla, &orbit, &bla, dc_re, dc_im, 0, 4.0, tol, max_itrs
+            );
+
+            /* Assert */
+            TEST_ASSERT_EQUAL(done_plain, done_bla);
+            if (fabsf(px_plain.itrs - px_bla.itrs) > tolerance) {
+                ++mismatches;
+            }
+        }
+    }
+
+    TEST_ASSERT_LESS_OR_EQUAL_INT(max_mismatches, mismatches);
+
+    /* Cleanup */
+    BlaTable_clear(&bla);
+    ReferenceOrbit_clear(&orbit);
+    PixelData_clear(&px_plain);
+    PixelData_clear(&px_bla);
+    mpf_clear(re);
+    mpf_clear(im);
+}
+
+void
+setUp(void)
+{}
+
+void
+tearDown(void)
+{}
+
+int
+main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(_should_haveSingleStepsOnLowestLevel_when_computeTable);
+    RUN_TEST(_should_notFindBla_when_differenceIsLarge);
+    RUN_TEST(_should_skipAlignedBlock_when_differenceIsSmall);
+    RUN_TEST(_should_matchPlainPerturbation_when_useBla);
+
+    return UNITY_END();
+}
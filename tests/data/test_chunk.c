@@ -1,5 +1,6 @@
 #include "unity.h"
 
+#include <cutil/std/math.h>
 #include <cutil/std/stdlib.h>
 
 #include <app/settings.h>
@@ -23,9 +24,10 @@ _should_initializeChunkParamsCorrectly_when_provideSettings(void)
     ChunkParams_init(&params, &settings);
 
     /* Assert */
-    TEST_ASSERT_EQUAL_INT(600, params.stride);
+    TEST_ASSERT_EQUAL_INT(1200, params.stride);
     TEST_ASSERT_EQUAL_INT(200, params.num_px_re);
     TEST_ASSERT_EQUAL_INT(200, params.num_px_im);
+    TEST_ASSERT_EQUAL_INT(1400 * 1200, params.num_px_tot);
 }
 
 void
@@ -38,23 +40,32 @@ _should_initializeChunkDataCorrectly_when_provideSettingsAndPixelData(void)
     settings.num_chnks_re = 4;
     settings.num_chnks_im = 3;
 
-    PixelData *const px = malloc(settings.width * settings.height * sizeof *px);
+    ChunkParams params;
+    ChunkParams_init(&params, &settings);
+    PixelData *const px = malloc(params.num_px_tot * sizeof *px);
     ChunkData chunks = {0};
 
     /* Act */
     ChunkData_init(&chunks, &settings, px);
 
     /* Assert */
-    TEST_ASSERT_EQUAL_INT(4, chunks.num_re);
-    TEST_ASSERT_EQUAL_INT(3, chunks.num_im);
+    TEST_ASSERT_EQUAL_INT(7, chunks.num_re);
+    TEST_ASSERT_EQUAL_INT(6, chunks.num_im);
     TEST_ASSERT_NOT_NULL(chunks.data);
 
+    /* The last stored chunks are the margin before the image */
     for (int idx_chnk_re = 0; idx_chnk_re < chunks.num_re; ++idx_chnk_re) {
         for (int idx_chnk_im = 0; idx_chnk_im < chunks.num_im; ++idx_chnk_im) {
             const PixelChunk *const chunk
               = &chunks.data[idx_chnk_re * chunks.num_im + idx_chnk_im];
-            TEST_ASSERT_EQUAL_INT(idx_chnk_re, chunk->idx_re);
-            TEST_ASSERT_EQUAL_INT(idx_chnk_im, chunk->idx_im);
+            TEST_ASSERT_EQUAL_INT(
+              (idx_chnk_re == chunks.num_re - 1) ? -1 : idx_chnk_re,
+              chunk->idx_re
+            );
+            TEST_ASSERT_EQUAL_INT(
+              (idx_chnk_im == chunks.num_im - 1) ? -1 : idx_chnk_im,
+              chunk->idx_im
+            );
             TEST_ASSERT_EQUAL_INT(CHUNK_STATE_INVALID, chunk->state);
             TEST_ASSERT_NOT_NULL(chunk->data);
         }
@@ -75,7 +86,9 @@ _should_invalidateAllPixels_when_callInvalidateAllPixels(void)
     settings.num_chnks_re = 4;
     settings.num_chnks_im = 3;
 
-    PixelData *const px = malloc(settings.width * settings.height * sizeof *px);
+    ChunkParams params;
+    ChunkParams_init(&params, &settings);
+    PixelData *const px = malloc(params.num_px_tot * sizeof *px);
     ChunkData chunks = {0};
     ChunkData_init(&chunks, &settings, px);
 
@@ -104,7 +117,7 @@ _should_invalidateAllPixels_when_callInvalidateAllPixels(void)
 }
 
 void
-_should_shiftChunkCorrectly_when_provideShiftParameters(void)
+_should_reuseOnlyLeavingChunks_when_shiftByPixels(void)
 {
     /* Arrange */
     Settings settings = {0};
@@ -113,20 +126,257 @@ _should_shiftChunkCorrectly_when_provideShiftParameters(void)
     settings.num_chnks_re = 4;
     settings.num_chnks_im = 3;
 
-    PixelData *const px = malloc(settings.width * settings.height * sizeof *px);
+    ChunkParams params;
+    ChunkParams_init(&params, &settings);
+    PixelData *const px = malloc(params.num_px_tot * sizeof *px);
     ChunkData chunks = {0};
     ChunkData_init(&chunks, &settings, px);
 
-    PixelChunk *const chunk = &chunks.data[0];
-    const int shifts[2] = {-1, 1};
+    const int num_tot = chunks.num_re * chunks.num_im;
+    for (int idx = 0; idx < num_tot; ++idx) {
+        chunks.data[idx].state = CHUNK_STATE_VALID;
+    }
 
     /* Act */
-    PixelChunk_callback_shift(chunk, &chunks, shifts);
+    ChunkData_shift(&chunks, 30, -5);
 
     /* Assert */
-    TEST_ASSERT_EQUAL_INT(1, chunk->idx_re);
-    TEST_ASSERT_EQUAL_INT(2, chunk->idx_im);
-    TEST_ASSERT_EQUAL_INT(CHUNK_STATE_INVALID, chunk->state);
+    TEST_ASSERT_EQUAL_INT(30, chunks.org_re);
+    TEST_ASSERT_EQUAL_INT(-5, chunks.org_im);
+    for (int idx = 0; idx < num_tot; ++idx) {
+        const PixelChunk *const chunk = &chunks.data[idx];
+        const int idx_chnk_re = idx / chunks.num_im;
+        const int idx_chnk_im = idx % chunks.num_im;
+        TEST_ASSERT_EQUAL_INT(
+          (idx_chnk_re == chunks.num_re - 1) ? -1 : idx_chnk_re, chunk->idx_re
+        );
+        if (idx_chnk_im == chunks.num_im - 2) {
+            TEST_ASSERT_EQUAL_INT(-2, chunk->idx_im);
+            TEST_ASSERT_EQUAL_INT(CHUNK_STATE_INVALID, chunk->state);
+        } else {
+            TEST_ASSERT_EQUAL_INT(
+              (idx_chnk_im == chunks.num_im - 1) ? -1 : idx_chnk_im,
+              chunk->idx_im
+            );
+            TEST_ASSERT_EQUAL_INT(CHUNK_STATE_VALID, chunk->state);
+        }
+    }
+
+    /* Cleanup */
+    ChunkData_clear(&chunks);
+    free(px);
+}
+
+void
+_should_findChunkByPosition_when_allChunksShifted(void)
+{
+    /* Arrange */
+    Settings settings = {0};
+    settings.width = 800;
+    settings.height = 600;
+    settings.num_chnks_re = 4;
+    settings.num_chnks_im = 3;
+
+    ChunkParams params;
+    ChunkParams_init(&params, &settings);
+    PixelData *const px = malloc(params.num_px_tot * sizeof *px);
+    ChunkData chunks = {0};
+    ChunkData_init(&chunks, &settings, px);
+
+    /* Act */
+    ChunkData_shift(&chunks, -250, 410);
+
+    /* Assert */
+    for (int idx_chnk_re = -3; idx_chnk_re < 4; ++idx_chnk_re) {
+        for (int idx_chnk_im = 1; idx_chnk_im < 7; ++idx_chnk_im) {
+            const PixelChunk *const chunk
+              = ChunkData_get_chunk(&chunks, idx_chnk_re, idx_chnk_im);
+            TEST_ASSERT_NOT_NULL(chunk);
+            TEST_ASSERT_EQUAL_INT(idx_chnk_re, chunk->idx_re);
+            TEST_ASSERT_EQUAL_INT(idx_chnk_im, chunk->idx_im);
+        }
+    }
+    TEST_ASSERT_NULL(ChunkData_get_chunk(&chunks, 4, 1));
+    TEST_ASSERT_NULL(ChunkData_get_chunk(&chunks, -3, 0));
+
+    const PixelChunk *const first = ChunkData_get_chunk(&chunks, -2, 2);
+    TEST_ASSERT_EQUAL_PTR(first, ChunkData_get_chunk_of_pixel(&chunks, 0, 0));
+    TEST_ASSERT_EQUAL_PTR(
+      &first->data[150 * params.stride + 10],
+      ChunkData_get_pixel(&chunks, 0, 0)
+    );
+
+    /* Cleanup */
+    ChunkData_clear(&chunks);
+    free(px);
+}
+
+void
+_should_keepMarginChunks_when_shiftByOneChunk(void)
+{
+    /* Arrange */
+    Settings settings = {0};
+    settings.width = 800;
+    settings.height = 600;
+    settings.num_chnks_re = 4;
+    settings.num_chnks_im = 3;
+
+    ChunkParams params;
+    ChunkParams_init(&params, &settings);
+    PixelData *const px = malloc(params.num_px_tot * sizeof *px);
+    ChunkData chunks = {0};
+    ChunkData_init(&chunks, &settings, px);
+
+    const int num_tot = chunks.num_re * chunks.num_im;
+    for (int idx = 0; idx < num_tot; ++idx) {
+        chunks.data[idx].state = CHUNK_STATE_VALID;
+    }
+    PixelChunk *const margin = ChunkData_get_chunk(&chunks, 4, 1);
+    TEST_ASSERT_FALSE(PixelChunk_is_visible(margin, &chunks));
+
+    /* Act */
+    ChunkData_shift(&chunks, 200, 0);
+
+    /* Assert */
+    TEST_ASSERT_EQUAL_PTR(margin, ChunkData_get_chunk(&chunks, 4, 1));
+    TEST_ASSERT_TRUE(PixelChunk_is_visible(margin, &chunks));
+    TEST_ASSERT_EQUAL_INT(CHUNK_STATE_VALID, margin->state);
+    for (int idx = 0; idx < num_tot; ++idx) {
+        const PixelChunk *const chunk = &chunks.data[idx];
+        TEST_ASSERT_EQUAL_INT(
+          (chunk->idx_re == 6) ? CHUNK_STATE_INVALID : CHUNK_STATE_VALID,
+          chunk->state
+        );
+        TEST_ASSERT_TRUE(chunk->idx_re >= 0 && chunk->idx_re <= 6);
+    }
+
+    /* Cleanup */
+    ChunkData_clear(&chunks);
+    free(px);
+}
+
+static void
+_fill_pixels_by_position(ChunkData *chunks, int width, int height)
+{
+    const int num_tot = chunks->num_re * chunks->num_im;
+    for (int idx = 0; idx < num_tot; ++idx) {
+        PixelChunk_invalidate_all_pixels(&chunks->data[idx], chunks);
+    }
+
+    for (int idx_re = 0; idx_re < width; ++idx_re) {
+        for (int idx_im = 0; idx_im < height; ++idx_im) {
+            PixelData *const px = ChunkData_get_pixel(chunks, idx_re, idx_im);
+            px->itrs = (float) (idx_re * height + idx_im);
+            px->state = PIXEL_STATE_VALID;
+            px->flags = PIXEL_FLAG_NONE;
+        }
+    }
+}
+
+void
+_should_keepCoincidingAndPreviewOtherPixels_when_zoomIn(void)
+{
+    /* Arrange */
+    Settings settings = {0};
+    settings.width = 80;
+    settings.height = 60;
+    settings.num_chnks_re = 4;
+    settings.num_chnks_im = 3;
+    settings.zoom_fac = 0.5;
+
+    ChunkParams params;
+    ChunkParams_init(&params, &settings);
+    PixelData *const px = malloc(params.num_px_tot * sizeof *px);
+    ChunkData chunks = {0};
+    ChunkData_init(&chunks, &settings, px);
+
+    const int num_tot = chunks.num_re * chunks.num_im;
+    ChunkData_shift(&chunks, 27, -13);
+    _fill_pixels_by_position(&chunks, settings.width, settings.height);
+
+    /* Act */
+    ChunkData_zoom(&chunks, 1);
+
+    /* Assert */
+    const int idx_cntr_re = settings.width / 2;
+    const int idx_cntr_im = settings.height / 2;
+    for (int idx_re = 0; idx_re < settings.width; ++idx_re) {
+        for (int idx_im = 0; idx_im < settings.height; ++idx_im) {
+            const PixelData *const new
+              = ChunkData_get_pixel(&chunks, idx_re, idx_im);
+            const int offs_re = idx_re - idx_cntr_re;
+            const int offs_im = idx_im - idx_cntr_im;
+            const int idx_src_re = idx_cntr_re + (int) round(0.5 * offs_re);
+            const int idx_src_im = idx_cntr_im + (int) round(0.5 * offs_im);
+            const bool is_exact = (offs_re % 2 == 0 && offs_im % 2 == 0);
+            TEST_ASSERT_EQUAL_INT(
+              is_exact ? PIXEL_STATE_VALID : PIXEL_STATE_INTERPOLATED,
+              new->state
+            );
+            TEST_ASSERT_EQUAL_FLOAT(
+              (float) (idx_src_re * settings.height + idx_src_im), new->itrs
+            );
+        }
+    }
+
+    for (int idx = 0; idx < num_tot; ++idx) {
+        TEST_ASSERT_EQUAL_INT(CHUNK_STATE_INVALID, chunks.data[idx].state);
+    }
+
+    /* Cleanup */
+    ChunkData_clear(&chunks);
+    free(px);
+}
+
+void
+_should_keepCoincidingPixels_when_zoomOut(void)
+{
+    /* Arrange */
+    Settings settings = {0};
+    settings.width = 80;
+    settings.height = 60;
+    settings.num_chnks_re = 4;
+    settings.num_chnks_im = 3;
+    settings.zoom_fac = 0.5;
+
+    ChunkParams params;
+    ChunkParams_init(&params, &settings);
+    PixelData *const px = malloc(params.num_px_tot * sizeof *px);
+    ChunkData chunks = {0};
+    ChunkData_init(&chunks, &settings, px);
+
+    const int num_tot = chunks.num_re * chunks.num_im;
+    ChunkData_shift(&chunks, -9, 31);
+    _fill_pixels_by_position(&chunks, settings.width, settings.height);
+
+    /* Act */
+    ChunkData_zoom(&chunks, -1);
+
+    /* Assert */
+    const int idx_cntr_re = settings.width / 2;
+    const int idx_cntr_im = settings.height / 2;
+    for (int idx_re = 0; idx_re < settings.width; ++idx_re) {
+        for (int idx_im = 0; idx_im < settings.height; ++idx_im) {
+            const PixelData *const new
+              = ChunkData_get_pixel(&chunks, idx_re, idx_im);
+            const int idx_src_re = idx_cntr_re + 2 * (idx_re - idx_cntr_re);
+            const int idx_src_im = idx_cntr_im + 2 * (idx_im - idx_cntr_im);
+            if (idx_src_re < 0 || idx_src_re >= settings.width
+                || idx_src_im < 0 || idx_src_im >= settings.height)
+            {
+                TEST_ASSERT_EQUAL_INT(PIXEL_STATE_INVALID, new->state);
+                continue;
+            }
+            TEST_ASSERT_EQUAL_INT(PIXEL_STATE_VALID, new->state);
+            TEST_ASSERT_EQUAL_FLOAT(
+              (float) (idx_src_re * settings.height + idx_src_im), new->itrs
+            );
+        }
+    }
+
+    for (int idx = 0; idx < num_tot; ++idx) {
+        TEST_ASSERT_EQUAL_INT(CHUNK_STATE_INVALID, chunks.data[idx].state);
+    }
 
     /* Cleanup */
     ChunkData_clear(&chunks);
@@ -143,7 +393,9 @@ _should_resetChunkCorrectly_when_callResetCallback(void)
     settings.num_chnks_re = 4;
     settings.num_chnks_im = 3;
 
-    PixelData *const px = malloc(settings.width * settings.height * sizeof *px);
+    ChunkParams params;
+    ChunkParams_init(&params, &settings);
+    PixelData *const px = malloc(params.num_px_tot * sizeof *px);
     ChunkData chunks = {0};
     ChunkData_init(&chunks, &settings, px);
 
@@ -189,7 +441,11 @@ main(void)
       _should_initializeChunkDataCorrectly_when_provideSettingsAndPixelData
     );
     RUN_TEST(_should_invalidateAllPixels_when_callInvalidateAllPixels);
-    RUN_TEST(_should_shiftChunkCorrectly_when_provideShiftParameters);
+    RUN_TEST(_should_reuseOnlyLeavingChunks_when_shiftByPixels);
+    RUN_TEST(_should_findChunkByPosition_when_allChunksShifted);
+    RUN_TEST(_should_keepMarginChunks_when_shiftByOneChunk);
+    RUN_TEST(_should_keepCoincidingAndPreviewOtherPixels_when_zoomIn);
+    RUN_TEST(_should_keepCoincidingPixels_when_zoomOut);
     RUN_TEST(_should_resetChunkCorrectly_when_callResetCallback);
     
     return UNITY_END();
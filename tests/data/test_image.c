@@ -0,0 +1,449 @@
+#include "unity.h"
+
+#include <cutil/std/math.h>
+#include <cutil/std/stdio.h>
+#include <cutil/std/stdlib.h>
+#include <cutil/std/string.h>
+
+#include <app/settings.h>
+#include <data/image.h>
+
+/**
+ * Centre of the views deep in the seahorse valley
+ */
+#define TEST_CENTRE_REAL -0.743643887037151
+#define TEST_CENTRE_IMAG 0.131825904205330
+
+/**
+ * Offset of the view centre from TEST_CENTRE_REAL, so that no nucleus is found
+ * in the view and the reference point is the centre of the view
+ */
+#define TEST_OFFSET_REAL 5e-11
+
+static void
+_settings_set_str(char **member, const char *value)
+{
+    free(*member);
+    *member = cutil_strdup(value);
+}
+
+static Settings *
+_settings_create_view(
+  double cntr_re, double cntr_im, double width_re, uint16_t max_itrs,
+  const char *kernel
+)
+{
+    Settings *const settings = Settings_create();
+    settings->width = 80;
+    settings->height = 60;
+    settings->num_chnks_re = 4;
+    settings->num_chnks_im = 3;
+    settings->min_re = cntr_re - 0.5 * width_re;
+    settings->max_re = cntr_re + 0.5 * width_re;
+    settings->cntr_im = cntr_im;
+    settings->max_itrs = max_itrs;
+    _settings_set_str(&settings->kernel, kernel);
+    _settings_set_str(&settings->fill, "off");
+    return settings;
+}
+
+static void
+_imageData_finish(ImageData *imgdata)
+{
+    while (ImageData_perform_action(imgdata, 1000U)) {
+    }
+}
+
+static float *
+_imageData_copy_pixels(const ImageData *imgdata, const Settings *settings)
+{
+    const int num = settings->width * settings->height;
+    float *const pixels = malloc(num * sizeof *pixels);
+    memcpy(pixels, ImageData_get_pixel_data(imgdata), num * sizeof *pixels);
+    return pixels;
+}
+
+static float *
+_imageData_render(const Settings *settings)
+{
+    ImageData *const imgdata = ImageData_create(settings);
+    _imageData_finish(imgdata);
+    float *const pixels = _imageData_copy_pixels(imgdata, settings);
+    ImageData_free(imgdata);
+    return pixels;
+}
+
+/**
+ * Asserts that the `num` values in `pixels` and `expected` only differ for few
+ * chaotic pixels close to the set.
+ */
+static void
+_pixels_assert_match(const float *pixels, const float *expected, int num)
+{
+    const int max_mismatches = num / 100;
+    const float tolerance = 0.01F;
+    int mismatches = 0;
+    for (int i = 0; i < num; ++i) {
+        if (fabsf(pixels[i] - expected[i]) > tolerance) {
+            ++mismatches;
+        }
+    }
+    TEST_ASSERT_LESS_OR_EQUAL_INT(max_mismatches, mismatches);
+}
+
+/**
+ * Asserts that the images rendered with `kernel` and the mpf kernel at the
+ * given view only differ for few chaotic pixels close to the set.
+ */
+static void
+_imageData_assert_match_mpf(
+  double cntr_re, double cntr_im, double width_re, uint16_t max_itrs,
+  const char *kernel
+)
+{
+    /* Arrange */
+    Settings *const settings
+      = _settings_create_view(cntr_re, cntr_im, width_re, max_itrs, kernel);
+    Settings *const settings_mpf
+      = _settings_create_view(cntr_re, cntr_im, width_re, max_itrs, "mpf");
+    const int num = settings->width * settings->height;
+
+    /* Act */
+    float *const pixels = _imageData_render(settings);
+    float *const pixels_mpf = _imageData_render(settings_mpf);
+
+    /* Assert */
+    _pixels_assert_match(pixels, pixels_mpf, num);
+
+    /* Cleanup */
+    free(pixels);
+    free(pixels_mpf);
+    Settings_free(settings);
+    Settings_free(settings_mpf);
+}
+
+static void
+_should_matchMpfKernel_when_autoKernelIsNearDoubleLimit(void)
+{
+    /* Doubles resolve the pixels, but not their orbits over all iterations */
+    _imageData_assert_match_mpf(
+      TEST_CENTRE_REAL, TEST_CENTRE_IMAG, 7.5e-8, 2000, "auto"
+    );
+}
+
+static void
+_should_matchMpfKernel_when_autoKernelIsBeyondDoubleLimit(void)
+{
+    _imageData_assert_match_mpf(
+      TEST_CENTRE_REAL, TEST_CENTRE_IMAG, 2.5e-11, 2000, "auto"
+    );
+}
+
+static void
+_should_matchMpfKernel_when_autoKernelUsesPerturbation(void)
+{
+    /* Series approximation skips a large part of the iterations here */
+    _imageData_assert_match_mpf(
+      TEST_CENTRE_REAL, TEST_CENTRE_IMAG, 9.765625e-14, 8000, "auto"
+    );
+}
+
+/**
+ * Asserts that the images rendered in the given fill mode and without filling
+ * at the view of the given width around the seahorse valley only differ for
+ * few pixels.
+ */
+static void
+_imageData_assert_fill_match(double width_re, const char *fill)
+{
+    /* Arrange */
+    Settings *const settings = _settings_create_view(
+      TEST_CENTRE_REAL, TEST_CENTRE_IMAG, width_re, 2000, "auto"
+    );
+    _settings_set_str(&settings->fill, fill);
+    Settings *const settings_off = _settings_create_view(
+      TEST_CENTRE_REAL, TEST_CENTRE_IMAG, width_re, 2000, "auto"
+    );
+    const int num = settings->width * settings->height;
+
+    /* Act */
+    float *const pixels = _imageData_render(settings);
+    float *const pixels_off = _imageData_render(settings_off);
+
+    /* Assert */
+    _pixels_assert_match(pixels, pixels_off, num);
+
+    /* Cleanup */
+    free(pixels);
+    free(pixels_off);
+    Settings_free(settings);
+    Settings_free(settings_off);
+}
+
+static void
+_should_matchUnfilledImage_when_fillModeIsBorder(void)
+{
+    /* Filaments may slip through the borders of filled rectangles here */
+    _imageData_assert_fill_match(0.1, "border");
+}
+
+static void
+_should_matchUnfilledImage_when_fillModeIsInterval(void)
+{
+    /* Rectangles are only proven outside the set, where all pixels escape */
+    _imageData_assert_fill_match(4.0, "interval");
+}
+
+static void
+_should_becomeIdle_when_prefetchViewSymmetricToRealAxis(void)
+{
+    /* Arrange */
+    const int max_actions = 100;
+    Settings *const settings
+      = _settings_create_view(-0.5, 0.0, 3.0, 500, "auto");
+    ImageData *const imgdata = ImageData_create(settings);
+    _imageData_finish(imgdata);
+
+    /* Act */
+    for (int i = 0; i < max_actions && !ImageData_is_idle(imgdata); ++i) {
+        ImageData_perform_action(imgdata, 1000U);
+    }
+
+    /* Assert */
+    TEST_ASSERT_TRUE(ImageData_is_idle(imgdata));
+
+    /* Cleanup */
+    ImageData_free(imgdata);
+    Settings_free(settings);
+}
+
+/**
+ * Asserts that the image of a view symmetric to the real axis with `height`
+ * rows in `num_chnks_im` chunks has equal conjugate rows and matches the mpf
+ * kernel in a single row of chunks, none of which can be mirrored.
+ */
+static void
+_imageData_assert_mirror_match(int height, int num_chnks_im)
+{
+    /* Arrange */
+    Settings *const settings
+      = _settings_create_view(-0.75, 0.0, 0.5, 500, "auto");
+    settings->height = height;
+    settings->num_chnks_im = num_chnks_im;
+    Settings *const settings_mpf
+      = _settings_create_view(-0.75, 0.0, 0.5, 500, "mpf");
+    settings_mpf->height = height;
+    settings_mpf->num_chnks_im = 1;
+    const int num = settings->width * height;
+
+    /* Act */
+    float *const pixels = _imageData_render(settings);
+    float *const pixels_mpf = _imageData_render(settings_mpf);
+
+    /* Assert */
+    for (int idx_re = 0; idx_re < settings->width; ++idx_re) {
+        const float *const column = &pixels[idx_re * height];
+        for (int idx_im = 0; idx_im < height; ++idx_im) {
+            /* Row idx_im lies at (idx_im - height / 2) * upp */
+            const int idx_mirror = 2 * (height / 2) - idx_im;
+            if (idx_mirror < height) {
+                TEST_ASSERT_EQUAL_FLOAT(column[idx_mirror], column[idx_im]);
+            }
+        }
+    }
+    _pixels_assert_match(pixels, pixels_mpf, num);
+
+    /* Cleanup */
+    free(pixels);
+    free(pixels_mpf);
+    Settings_free(settings);
+    Settings_free(settings_mpf);
+}
+
+static void
+_should_mirrorConjugateRows_when_heightIsEven(void)
+{
+    /* Row 0 has no conjugate row */
+    _imageData_assert_mirror_match(60, 6);
+}
+
+static void
+_should_mirrorConjugateRows_when_heightIsOdd(void)
+{
+    _imageData_assert_mirror_match(63, 7);
+}
+
+static void
+_should_matchMpfKernel_when_loadViewWithTooLowPrecision(void)
+{
+    /* Arrange */
+    const char *const fname = "test_image_view.json";
+    const uint16_t max_itrs = 8000;
+    Settings *const settings
+      = _settings_create_view(-0.5, 0.0, 3.0, max_itrs, "auto");
+    _settings_set_str(&settings->view_file, fname);
+
+    /* Binary fractions, so that the view file matches the settings exactly */
+    const double upp = ldexp(1.0, -50);
+    Settings *const settings_mpf = _settings_create_view(
+      TEST_CENTRE_REAL, TEST_CENTRE_IMAG, settings->width * upp, max_itrs,
+      "mpf"
+    );
+    const int num = settings->width * settings->height;
+
+    /* Precision of views saved before the iterations were accounted for */
+    FILE *const out = fopen(fname, "w");
+    TEST_ASSERT_NOT_NULL(out);
+    fprintf(
+      out,
+      "{\"prec\": 64, \"cntr_re\": \"%.60f\", \"cntr_im\": \"%.60f\", "
+      "\"upp\": \"%.50e\"}\n",
+      TEST_CENTRE_REAL, TEST_CENTRE_IMAG, upp
+    );
+    fclose(out);
+
+    ImageData *const imgdata = ImageData_create(settings);
+    _imageData_finish(imgdata);
+
+    /* Act */
+    ImageData_register_action(imgdata, KEY_VIEW_LOAD);
+    _imageData_finish(imgdata);
+
+    /* Assert */
+    float *const pixels = _imageData_copy_pixels(imgdata, settings);
+    float *const pixels_mpf = _imageData_render(settings_mpf);
+    _pixels_assert_match(pixels, pixels_mpf, num);
+
+    /* Cleanup */
+    free(pixels);
+    free(pixels_mpf);
+    ImageData_free(imgdata);
+    Settings_free(settings);
+    Settings_free(settings_mpf);
+    remove(fname);
+}
+
+static void
+_imageData_register_and_finish(ImageData *imgdata, enum Key key)
+{
+    ImageData_register_action(imgdata, key);
+    _imageData_finish(imgdata);
+}
+
+static void
+_should_reuseReferenceOrbit_when_referenceStaysInView(void)
+{
+    /* Arrange */
+    const double cntr_re = TEST_CENTRE_REAL + TEST_OFFSET_REAL;
+    const double width_re = 2.5e-11;
+    Settings *const settings = _settings_create_view(
+      cntr_re, TEST_CENTRE_IMAG, width_re, 2000, "auto"
+    );
+    const int num = settings->width * settings->height;
+    ImageData *const imgdata = ImageData_create(settings);
+    _imageData_finish(imgdata);
+
+    const ReferenceOrbit *orbit = ImageData_get_reference_orbit(imgdata);
+    TEST_ASSERT_NOT_NULL(orbit);
+    mpf_t ref_re, ref_im;
+    mpf_init2(ref_re, mpf_get_prec(orbit->re));
+    mpf_init2(ref_im, mpf_get_prec(orbit->im));
+    mpf_set(ref_re, orbit->re);
+    mpf_set(ref_im, orbit->im);
+
+    /* Each shift moves the view by a 40th of its width */
+    const double upp = width_re / settings->width;
+    const double shift = 2.0 * (settings->width / 40) * upp;
+    Settings *const settings_final = _settings_create_view(
+      cntr_re + shift, TEST_CENTRE_IMAG, settings->zoom_fac * width_re, 2000,
+      "auto"
+    );
+
+    /* Act */
+    _imageData_register_and_finish(imgdata, KEY_RIGHT);
+    _imageData_register_and_finish(imgdata, KEY_RIGHT);
+    _imageData_register_and_finish(imgdata, KEY_ZOOM_IN);
+
+    /* Assert */
+    orbit = ImageData_get_reference_orbit(imgdata);
+    TEST_ASSERT_NOT_NULL(orbit);
+    TEST_ASSERT_EQUAL_INT(0, mpf_cmp(ref_re, orbit->re));
+    TEST_ASSERT_EQUAL_INT(0, mpf_cmp(ref_im, orbit->im));
+
+    float *const pixels = _imageData_copy_pixels(imgdata, settings);
+    float *const pixels_final = _imageData_render(settings_final);
+    _pixels_assert_match(pixels, pixels_final, num);
+
+    /* Cleanup */
+    free(pixels);
+    free(pixels_final);
+    mpf_clear(ref_re);
+    mpf_clear(ref_im);
+    ImageData_free(imgdata);
+    Settings_free(settings);
+    Settings_free(settings_final);
+}
+
+static void
+_should_recomputeReferenceOrbit_when_referenceLeavesView(void)
+{
+    /* Arrange */
+    Settings *const settings = _settings_create_view(
+      TEST_CENTRE_REAL + TEST_OFFSET_REAL, TEST_CENTRE_IMAG, 2.5e-11, 2000,
+      "auto"
+    );
+    ImageData *const imgdata = ImageData_create(settings);
+    _imageData_finish(imgdata);
+
+    const ReferenceOrbit *orbit = ImageData_get_reference_orbit(imgdata);
+    TEST_ASSERT_NOT_NULL(orbit);
+    mpf_t ref_re;
+    mpf_init2(ref_re, mpf_get_prec(orbit->re));
+    mpf_set(ref_re, orbit->re);
+
+    /* Shifts by a 40th of the width move the centre out after half of it */
+    const int num_shifts = 40 / 2 + 1;
+
+    /* Act */
+    for (int i = 0; i < num_shifts; ++i) {
+        _imageData_register_and_finish(imgdata, KEY_RIGHT);
+    }
+
+    /* Assert */
+    orbit = ImageData_get_reference_orbit(imgdata);
+    TEST_ASSERT_NOT_NULL(orbit);
+    TEST_ASSERT_GREATER_THAN_INT(0, mpf_cmp(orbit->re, ref_re));
+
+    /* Cleanup */
+    mpf_clear(ref_re);
+    ImageData_free(imgdata);
+    Settings_free(settings);
+}
+
+void
+setUp(void)
+{}
+
+void
+tearDown(void)
+{}
+
+int
+main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(_should_matchMpfKernel_when_autoKernelIsNearDoubleLimit);
+    RUN_TEST(_should_matchMpfKernel_when_autoKernelIsBeyondDoubleLimit);
+    RUN_TEST(_should_matchMpfKernel_when_autoKernelUsesPerturbation);
+    RUN_TEST(_should_matchUnfilledImage_when_fillModeIsBorder);
+    RUN_TEST(_should_matchUnfilledImage_when_fillModeIsInterval);
+    RUN_TEST(_should_becomeIdle_when_prefetchViewSymmetricToRealAxis);
+    RUN_TEST(_should_matchMpfKernel_when_loadViewWithTooLowPrecision);
+    RUN_TEST(_should_mirrorConjugateRows_when_heightIsEven);
+    RUN_TEST(_should_mirrorConjugateRows_when_heightIsOdd);
+    RUN_TEST(_should_reuseReferenceOrbit_when_referenceStaysInView);
+    RUN_TEST(_should_recomputeReferenceOrbit_when_referenceLeavesView);
+
+    return UNITY_END();
+}
@@ -0,0 +1,150 @@
+#include "unity.h"
+
+#include <data/interior.h>
+#include <data/pixel.h>
+
+static void
+_should_beInterior_when_positionIsInCardioidOrBulb(void)
+{
+    /* Arrange */
+    const double positions[][2] = {
+      {0.0, 0.0}, {0.2, 0.0}, {-0.5, 0.5}, {-1.0, 0.0}, {-1.2, 0.1},
+    };
+    const size_t num = (sizeof positions) / (sizeof *positions);
+
+    InteriorCache cache = {0};
+    InteriorCache_init(&cache);
+
+    for (size_t i = 0; i < num; ++i) {
+        /* Act */
+        const bool is_interior
+          = InteriorCache_contains(&cache, positions[i][0], positions[i][1]);
+
+        /* Assert */
+        TEST_ASSERT_TRUE(is_interior);
+    }
+}
+
+static void
+_should_notBeInterior_when_positionIsOutsideCardioidAndBulb(void)
+{
+    /* Arrange */
+    const double positions[][2] = {
+      {0.26, 0.0}, {-0.5, 0.7}, {-1.26, 0.0}, {0.0, 1.0}, {-1.75, 0.0},
+    };
+    const size_t num = (sizeof positions) / (sizeof *positions);
+
+    InteriorCache cache = {0};
+    InteriorCache_init(&cache);
+
+    for (size_t i = 0; i < num; ++i) {
+        /* Act */
+        const bool is_interior
+          = InteriorCache_contains(&cache, positions[i][0], positions[i][1]);
+
+        /* Assert */
+        TEST_ASSERT_FALSE(is_interior);
+    }
+}
+
+static void
+_should_findPeriod_when_positionIsNearNucleus(void)
+{
+    /* Arrange */
+    const double positions[][2] = {
+      {0.0, 0.0},
+      {-1.0, 0.0},
+      {-1.7548, 0.0},
+      {-0.1226, 0.7449},
+    };
+    const int periods[] = {1, 2, 3, 3};
+    const size_t num = (sizeof periods) / (sizeof *periods);
+
+    for (size_t i = 0; i < num; ++i) {
+        /* Act */
+        const int period
+          = Interior_find_atom_period(positions[i][0], positions[i][1], 100);
+
+        /* Assert */
+        TEST_ASSERT_EQUAL_INT(periods[i], period);
+    }
+}
+
+static void
+_should_cacheConvergingDisk_when_findPeriodThreeComponent(void)
+{
+    /* Arrange */
+    const uint16_t max_itrs = 1000;
+    InteriorDisk disk = {0};
+    InteriorCache cache = {0};
+    InteriorCache_init(&cache);
+
+    /* Act */
+    const bool found = Interior_find_disk(&disk, -1.75, 0.01, 3, max_itrs);
+    const bool added = InteriorCache_add(&cache, &disk);
+    const bool added_twice = InteriorCache_add(&cache, &disk);
+    InteriorCache_select(&cache, -2.0, -1.5, -0.25, 0.25);
+
+    /* Assert */
+    TEST_ASSERT_TRUE(found);
+    TEST_ASSERT_TRUE(added);
+    TEST_ASSERT_FALSE(added_twice);
+    TEST_ASSERT_EQUAL_INT(3, disk.period);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, -1.7548776662466927, disk.re);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 0.0, disk.im);
+    TEST_ASSERT_TRUE(InteriorCache_contains(&cache, disk.re, disk.im));
+
+    /* Every position in the disk has to converge (diagonal through it) */
+    PixelData px = {0};
+    PixelData_init(&px);
+    const double tol = PixelData_get_tolerance(0.0);
+    for (int i = -6; i <= 6; ++i) {
+        const double re = disk.re + 0.1 * i * disk.radius;
+        const double im = disk.im - 0.1 * i * disk.radius;
+        TEST_ASSERT_TRUE(InteriorCache_contains(&cache, re, im));
+        PixelData_iterate_double(&px, re, im, 4.0, tol, max_itrs);
+        TEST_ASSERT_EQUAL_FLOAT(0.0F, px.itrs);
+    }
+
+    /* Cleanup */
+    PixelData_clear(&px);
+}
+
+static void
+_should_ignoreDisk_when_diskIsOutsideSelection(void)
+{
+    /* Arrange */
+    InteriorDisk disk = {0};
+    InteriorCache cache = {0};
+    InteriorCache_init(&cache);
+    TEST_ASSERT_TRUE(Interior_find_disk(&disk, -1.75, 0.0, 3, 1000));
+    TEST_ASSERT_TRUE(InteriorCache_add(&cache, &disk));
+
+    /* Act */
+    InteriorCache_select(&cache, 0.0, 0.5, 0.0, 0.5);
+
+    /* Assert */
+    TEST_ASSERT_FALSE(InteriorCache_contains(&cache, disk.re, disk.im));
+}
+
+void
+setUp(void)
+{}
+
+void
+tearDown(void)
+{}
+
+int
+main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(_should_beInterior_when_positionIsInCardioidOrBulb);
+    RUN_TEST(_should_notBeInterior_when_positionIsOutsideCardioidAndBulb);
+    RUN_TEST(_should_findPeriod_when_positionIsNearNucleus);
+    RUN_TEST(_should_cacheConvergingDisk_when_findPeriodThreeComponent);
+    RUN_TEST(_should_ignoreDisk_when_diskIsOutsideSelection);
+
+    return UNITY_END();
+}
@@ -0,0 +1,163 @@
+#include "unity.h"
+
+#include <cutil/std/math.h>
+
+#include <data/nucleus.h>
+
+static void
+_should_findPeriod_when_diskContainsNucleus(void)
+{
+    /* Arrange */
+    const double centres[][2] = {
+      {0.0, 0.0},
+      {-1.0, 0.0},
+      {-1.7548776662466927, 0.0},
+      {-0.1225611668766536, 0.7448617666197442},
+    };
+    const int periods[] = {1, 2, 3, 3};
+    const size_t num = (sizeof periods) / (sizeof *periods);
+
+    Nucleus nucleus = {0};
+    Nucleus_init(&nucleus);
+
+    mpf_t re, im, radius;
+    mpf_init(re);
+    mpf_init(im);
+    mpf_init_set_d(radius, 1e-6);
+
+    for (size_t i = 0; i < num; ++i) {
+        mpf_set_d(re, centres[i][0]);
+        mpf_set_d(im, centres[i][1]);
+
+        /* Act */
+        const int period = Nucleus_find_period(&nucleus, re, im, radius, 100);
+
+        /* Assert */
+        TEST_ASSERT_EQUAL_INT(periods[i], period);
+    }
+
+    /* Cleanup */
+    Nucleus_clear(&nucleus);
+    mpf_clear(re);
+    mpf_clear(im);
+    mpf_clear(radius);
+}
+
+static void
+_should_returnZero_when_centreEscapes(void)
+{
+    /* Arrange */
+    Nucleus nucleus = {0};
+    Nucleus_init(&nucleus);
+
+    mpf_t re, im, radius;
+    mpf_init_set_d(re, 1.0);
+    mpf_init_set_d(im, 1.0);
+    mpf_init_set_d(radius, 1e-6);
+
+    /* Act */
+    const int period = Nucleus_find_period(&nucleus, re, im, radius, 100);
+
+    /* Assert */
+    TEST_ASSERT_EQUAL_INT(0, period);
+
+    /* Cleanup */
+    Nucleus_clear(&nucleus);
+    mpf_clear(re);
+    mpf_clear(im);
+    mpf_clear(radius);
+}
+
+static void
+_should_convergeToNucleus_when_refineByNewton(void)
+{
+    /* Arrange */
+    Nucleus nucleus = {0};
+    mpf_set_default_prec(256UL);
+    Nucleus_init(&nucleus);
+
+    mpf_t re, im, tol;
+    mpf_init_set_d(re, -1.75);
+    mpf_init_set_d(im, 0.0);
+    mpf_init_set_d(tol, 1e-60);
+
+    /* Act */
+    const bool converged = Nucleus_refine(&nucleus, re, im, 3, tol, 64);
+
+    /* Assert */
+    TEST_ASSERT_TRUE(converged);
+    TEST_ASSERT_DOUBLE_WITHIN(
+      1e-15, -1.7548776662466927, mpf_get_d(nucleus.re)
+    );
+    TEST_ASSERT_DOUBLE_WITHIN(1e-15, 0.0, mpf_get_d(nucleus.im));
+
+    /* Orbit of nucleus on the real axis returns to 0 after period */
+    mpf_t z;
+    mpf_init_set_ui(z, 0UL);
+    for (int i = 0; i < 3; ++i) {
+        mpf_mul(z, z, z);
+        mpf_add(z, z, nucleus.re);
+    }
+    mpf_abs(z, z);
+    TEST_ASSERT_TRUE(mpf_cmp_d(z, 1e-50) < 0);
+
+    /* Cleanup */
+    Nucleus_clear(&nucleus);
+    mpf_clear(re);
+    mpf_clear(im);
+    mpf_clear(tol);
+    mpf_clear(z);
+}
+
+static void
+_should_findNucleusOfLowestPeriod_when_provideView(void)
+{
+    /* Arrange */
+    Nucleus nucleus = {0};
+    mpf_set_default_prec(256UL);
+    Nucleus_init(&nucleus);
+
+    /* Main cardioid of the period 3 minibrot lies in this disk */
+    mpf_t re, im, radius;
+    mpf_init_set_d(re, -1.7548);
+    mpf_init_set_d(im, 0.0001);
+    mpf_init_set_d(radius, 1e-3);
+
+    /* Act */
+    const bool found = Nucleus_find(&nucleus, re, im, radius, 1000);
+
+    /* Assert */
+    TEST_ASSERT_TRUE(found);
+    TEST_ASSERT_EQUAL_INT(3, nucleus.period);
+    TEST_ASSERT_DOUBLE_WITHIN(
+      1e-12, -1.7548776662466927, mpf_get_d(nucleus.re)
+    );
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 0.0, mpf_get_d(nucleus.im));
+
+    /* Cleanup */
+    Nucleus_clear(&nucleus);
+    mpf_clear(re);
+    mpf_clear(im);
+    mpf_clear(radius);
+}
+
+void
+setUp(void)
+{}
+
+void
+tearDown(void)
+{}
+
+int
+main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(_should_findPeriod_when_diskContainsNucleus);
+    RUN_TEST(_should_returnZero_when_centreEscapes);
+    RUN_TEST(_should_convergeToNucleus_when_refineByNewton);
+    RUN_TEST(_should_findNucleusOfLowestPeriod_when_provideView);
+
+    return UNITY_END();
+}
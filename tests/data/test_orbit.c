@@ -0,0 +1,421 @@
+#include "unity.h"
+
+#include <cutil/std/math.h>
+
+#include <data/orbit.h>
+#include <data/pixel.h>
+
+static void
+_referenceOrbit_assert_prec(const ReferenceOrbit *orbit, mp_bitcnt_t prec)
+{
+    TEST_ASSERT_EQUAL_UINT(prec, mpf_get_prec(orbit->re));
+    TEST_ASSERT_EQUAL_UINT(prec, mpf_get_prec(orbit->im));
+    TEST_ASSERT_EQUAL_UINT(prec, mpf_get_prec(orbit->z_re));
+    TEST_ASSERT_EQUAL_UINT(prec, mpf_get_prec(orbit->z_im));
+    TEST_ASSERT_EQUAL_UINT(prec, mpf_get_prec(orbit->re_sqr));
+    TEST_ASSERT_EQUAL_UINT(prec, mpf_get_prec(orbit->im_sqr));
+}
+
+static void
+_should_setOrbitPrecCorrectly_when_providePrec(void)
+{
+    /* Arrange */
+    const mp_bitcnt_t precs[] = {1024UL, 512UL, 256UL, 128UL, 64UL};
+    const size_t num = (sizeof precs) / (sizeof *precs);
+
+    ReferenceOrbit orbit = {0};
+    ReferenceOrbit_init(&orbit);
+
+    for (size_t i = 0; i < num; ++i) {
+        const mp_bitcnt_t prec = precs[i];
+
+        /* Act */
+        ReferenceOrbit_set_prec(&orbit, prec);
+
+        /* Assert */
+        _referenceOrbit_assert_prec(&orbit, prec);
+    }
+
+    /* Cleanup */
+    ReferenceOrbit_clear(&orbit);
+}
+
+static void
+_should_storeAllIterations_when_referenceIsInsideMandelbrotSet(void)
+{
+    /* Arrange */
+    const uint16_t max_itrs = 100;
+
+    ReferenceOrbit orbit = {0};
+    ReferenceOrbit_init(&orbit);
+
+    mpf_t re, im;
+    mpf_init_set_d(re, -1.0);
+    mpf_init_set_d(im, 0.0);
+
+    /* Act */
+    ReferenceOrbit_compute(&orbit, re, im, 4.0, max_itrs);
+
+    /* Assert */
+    TEST_ASSERT_EQUAL_INT(max_itrs + 1, orbit.len);
+    for (int i = 0; i < orbit.len; ++i) {
+        const double expected = (i % 2 == 0) ? 0.0 : -1.0;
+        TEST_ASSERT_EQUAL_DOUBLE(expected, orbit.orbit_re[i]);
+        TEST_ASSERT_EQUAL_DOUBLE(0.0, orbit.orbit_im[i]);
+    }
+
+    /* Cleanup */
+    ReferenceOrbit_clear(&orbit);
+    mpf_clear(re);
+    mpf_clear(im);
+}
+
+static void
+_should_stopAtEscape_when_referenceIsOutsideMandelbrotSet(void)
+{
+    /* Arrange */
+    ReferenceOrbit orbit = {0};
+    ReferenceOrbit_init(&orbit);
+
+    mpf_t re, im;
+    mpf_init_set_d(re, 2.0);
+    mpf_init_set_d(im, 0.0);
+
+    /* Act */
+    ReferenceOrbit_compute(&orbit, re, im, 4.0, 100);
+
+    /* Assert */
+    TEST_ASSERT_EQUAL_INT(3, orbit.len);
+    TEST_ASSERT_EQUAL_DOUBLE(0.0, orbit.orbit_re[0]);
+    TEST_ASSERT_EQUAL_DOUBLE(2.0, orbit.orbit_re[1]);
+    TEST_ASSERT_EQUAL_DOUBLE(6.0, orbit.orbit_re[2]);
+
+    /* Cleanup */
+    ReferenceOrbit_clear(&orbit);
+    mpf_clear(re);
+    mpf_clear(im);
+}
+
+static void
+_should_matchMpfKernel_when_usePerturbedKernel(void)
+{
+    /* Arrange */
+    enum { NUM = 16 };
+    const mp_bitcnt_t prec = 128UL;
+    const double ref_re = -0.7436438870371587;
+    const double ref_im = 0.1318259042053119;
+    const double upp = 1e-12;
+    const double tol = PixelData_get_tolerance(upp);
+    const uint16_t max_itrs = 1000;
+
+    /* Escape counts may only differ due to rounding of the deltas */
+    const int max_mismatches = (NUM * NUM) / 100;
+    const float tolerance = 1.0F / max_itrs;
+    int mismatches = 0;
+
+    ReferenceOrbit orbit = {0};
+    PixelData px_mpf = {0};
+    PixelData px_ptb = {0};
+    PixelDataBuffer buf = {0};
+
+    mpf_set_default_prec(prec);
+
+    mpf_t re, im, max_sqr;
+    mpf_init_set_d(re, ref_re);
+    mpf_init_set_d(im, ref_im);
+    mpf_init_set_d(max_sqr, 4.0);
+
+    ReferenceOrbit_init(&orbit);
+    PixelData_init(&px_mpf);
+    PixelData_init(&px_ptb);
+    PixelDataBuffer_init(&buf, max_sqr);
+
+    ReferenceOrbit_compute(&orbit, re, im, 4.0, max_itrs);
+
+    for (int idx_re = 0; idx_re < NUM; ++idx_re) {
+        for (int idx_im = 0; idx_im < NUM; ++idx_im) {
+            const double dc_re = (idx_re - NUM / 2) * upp;
+            const double dc_im = (idx_im - NUM / 2) * upp;
+
+            mpf_set_d(px_mpf.re, dc_re);
+            mpf_add(px_mpf.re, px_mpf.re, re);
+            mpf_set_d(px_mpf.im, dc_im);
+            mpf_add(px_mpf.im, px_mpf.im, im);
+
+            /* Act */
+            PixelData_iterate(&px_mpf, &buf, max_itrs);
+            const bool done = PixelData_iterate_perturbed(
+              &px_ptb, &orbit, NULL, dc_re, dc_im, 0, 4.0, tol, max_itrs
+            );
+
+            /* Assert */
+            if (!done || fabsf(px_mpf.itrs - px_ptb.itrs) > tolerance) {
+                ++mismatches;
+            }
+        }
+    }
+
+    TEST_ASSERT_LESS_OR_EQUAL_INT(max_mismatches, mismatches);
+
+    /* Cleanup */
+    ReferenceOrbit_clear(&orbit);
+    PixelData_clear(&px_mpf);
+    PixelData_clear(&px_ptb);
+    PixelDataBuffer_clear(&buf);
+    mpf_clear(re);
+    mpf_clear(im);
+    mpf_clear(max_sqr);
+}
+
+static void
+_should_matchUnskippedKernel_when_skipIterationsBySeries(void)
+{
+    /* Arrange */
+    enum { NUM = 16 };
+    const mp_bitcnt_t prec = 128UL;
+    const double ref_re = -0.7436438870371587;
+    const double ref_im = 0.1318259042053119;
+    const double upp = 1e-14;
+    const double tol = PixelData_get_tolerance(upp);
+    const double series_tol = 1e-9;
+    const uint16_t max_itrs = 5000;
+
+    /* Escape counts may only differ due to rounding of the deltas */
+    const int max_mismatches = (NUM * NUM) / 100;
+    const float tolerance = 1.0F / max_itrs;
+    int mismatches = 0;
+
+    ReferenceOrbit orbit = {0};
+    PixelData px_full = {0};
+    PixelData px_skip = {0};
+
+    mpf_set_default_prec(prec);
+
+    mpf_t re, im;
+    mpf_init_set_d(re, ref_re);
+    mpf_init_set_d(im, ref_im);
+
+    ReferenceOrbit_init(&orbit);
+    PixelData_init(&px_full);
+    PixelData_init(&px_skip);
+
+    ReferenceOrbit_compute(&orbit, re, im, 4.0, max_itrs);
+
+    const double dc_min = (0 - NUM / 2) * upp;
+    const double dc_max = (NUM - 1 - NUM / 2) * upp;
+    const double corners_re[] = {dc_min, dc_max, dc_min, dc_max};
+    const double corners_im[] = {dc_min, dc_min, dc_max, dc_max};
+
+    /* Act */
+    const int skip
+      = ReferenceOrbit_get_skip(
+        &orbit, corners_re, corners_im, 4, 4.0, series_tol
+      );
+
+    /* Assert */
+    TEST_ASSERT_GREATER_THAN_INT(0, skip);
+    TEST_ASSERT_LESS_THAN_INT(orbit.series_len, skip);
+
+    for (int idx_re = 0; idx_re < NUM; ++idx_re) {
+        for (int idx_im = 0; idx_im < NUM; ++idx_im) {
+            const double dc_re = (idx_re - NUM / 2) * upp;
+            const double dc_im = (idx_im - NUM / 2) * upp;
+
+            /* Act */
+            const bool done_full = PixelData_iterate_perturbed(
+              &px_full, &orbit, NULL, dc_re, dc_im, 0, 4.0, tol, max_itrs
+            );
+            const bool done_skip = PixelData_iterate_perturbed(
+              &px_skip, &orbit, NULL, dc_re, dc_im, skip, 4.0, tol,
+              max_itrs
+            );
+
+            /* Assert */
+            TEST_ASSERT_EQUAL(done_full, done_skip);
+            if (fabsf(px_full.itrs - px_skip.itrs) > tolerance) {
+                ++mismatches;
+            }
+        }
+    }
+
+    TEST_ASSERT_LESS_OR_EQUAL_INT(max_mismatches, mismatches);
+
+    /* Cleanup */
+    ReferenceOrbit_clear(&orbit);
+    PixelData_clear(&px_full);
+    PixelData_clear(&px_skip);
+    mpf_clear(re);
+    mpf_clear(im);
+}
+
+static void
+_should_matchMpfKernel_when_useFloatExpKernel(void)
+{
+    /* Arrange */
+    enum { NUM = 8 };
+    const mp_bitcnt_t prec = 1280UL;
+    const double ref_re = -1.99;
+    const double ref_im = 0.0;
+    const long exp_upp = -1100L;
+    const double tol = PixelData_get_tolerance(ldexp(1.0, exp_upp));
+    const uint16_t max_itrs = 2000;
+
+    /* Escape counts may only differ due to rounding of the deltas */
+    const int max_mismatches = (NUM * NUM) / 10;
+    const float tolerance = 1.0F / max_itrs;
+    int mismatches = 0;
+    int num_escaped = 0;
+
+    ReferenceOrbit orbit = {0};
+    PixelData px_mpf = {0};
+    PixelData px_fe = {0};
+    PixelDataBuffer buf = {0};
+
+    mpf_set_default_prec(prec);
+
+    mpf_t re, im, max_sqr, tmp;
+    mpf_init_set_d(re, ref_re);
+    mpf_init_set_d(im, ref_im);
+    mpf_init_set_d(max_sqr, 4.0);
+    mpf_init(tmp);
+
+    ReferenceOrbit_init(&orbit);
+    PixelData_init(&px_mpf);
+    PixelData_init(&px_fe);
+    PixelDataBuffer_init(&buf, max_sqr);
+
+    ReferenceOrbit_compute(&orbit, re, im, 4.0, max_itrs);
+
+    for (int idx_re = 0; idx_re < NUM; ++idx_re) {
+        for (int idx_im = 1; idx_im <= NUM; ++idx_im) {
+            /* Differences to the reference point underflow double */
+            const FloatExp dc_re
+              = FloatExp_normalize(idx_re - NUM / 2, exp_upp);
+            const FloatExp dc_im = FloatExp_normalize(idx_im, exp_upp);
+
+            mpf_set_d(tmp, idx_re - NUM / 2);
+            mpf_div_2exp(tmp, tmp, -exp_upp);
+            mpf_add(px_mpf.re, re, tmp);
+            mpf_set_d(tmp, idx_im);
+            mpf_div_2exp(tmp, tmp, -exp_upp);
+            mpf_add(px_mpf.im, im, tmp);
+
+            /* Act */
+            PixelData_iterate(&px_mpf, &buf, max_itrs);
+            const bool done = PixelData_iterate_perturbed_floatexp(
+              &px_fe, &orbit, NULL, dc_re, dc_im, 4.0, tol, max_itrs
+            );
+
+            /* Assert */
+            if (!done || fabsf(px_mpf.itrs - px_fe.itrs) > tolerance) {
+                ++mismatches;
+            }
+            if (px_mpf.itrs > 0.0F) {
+                ++num_escaped;
+            }
+        }
+    }
+
+    TEST_ASSERT_GREATER_THAN_INT(0, num_escaped);
+    TEST_ASSERT_LESS_OR_EQUAL_INT(max_mismatches, mismatches);
+
+    /* Cleanup */
+    ReferenceOrbit_clear(&orbit);
+    PixelData_clear(&px_mpf);
+    PixelData_clear(&px_fe);
+    PixelDataBuffer_clear(&buf);
+    mpf_clear(re);
+    mpf_clear(im);
+    mpf_clear(max_sqr);
+    mpf_clear(tmp);
+}
+
+static void
+_should_flagGlitch_when_pixelIsAtNucleusNearReference(void)
+{
+    /* Arrange */
+    ReferenceOrbit orbit = {0};
+    PixelData px = {0};
+
+    /* Pixel at nucleus -1 of period 2, reference point next to it */
+    const double dc = 1e-8;
+    mpf_t re, im;
+    mpf_init_set_d(re, -1.0 + dc);
+    mpf_init_set_d(im, 0.0);
+
+    ReferenceOrbit_init(&orbit);
+    PixelData_init(&px);
+
+    ReferenceOrbit_compute(&orbit, re, im, 4.0, 100);
+
+    /* Act */
+    const bool done = PixelData_iterate_perturbed(
+      &px, &orbit, NULL, -dc, 0.0, 0, 4.0, PixelData_get_tolerance(dc), 100
+    );
+
+    /* Assert */
+    TEST_ASSERT_TRUE(done);
+    TEST_ASSERT_EQUAL_INT(PIXEL_STATE_GLITCHED, px.state);
+
+    /* Cleanup */
+    ReferenceOrbit_clear(&orbit);
+    PixelData_clear(&px);
+    mpf_clear(re);
+    mpf_clear(im);
+}
+
+static void
+_should_returnFalse_when_pixelOutlivesReferenceOrbit(void)
+{
+    /* Arrange */
+    ReferenceOrbit orbit = {0};
+    PixelData px = {0};
+
+    mpf_t re, im;
+    mpf_init_set_d(re, 2.0);
+    mpf_init_set_d(im, 0.0);
+
+    ReferenceOrbit_init(&orbit);
+    PixelData_init(&px);
+
+    ReferenceOrbit_compute(&orbit, re, im, 4.0, 100);
+
+    /* Act */
+    const bool done = PixelData_iterate_perturbed(
+      &px, &orbit, NULL, -2.1, 0.0, 0, 4.0, PixelData_get_tolerance(0.0), 100
+    );
+
+    /* Assert */
+    TEST_ASSERT_FALSE(done);
+
+    /* Cleanup */
+    ReferenceOrbit_clear(&orbit);
+    PixelData_clear(&px);
+    mpf_clear(re);
+    mpf_clear(im);
+}
+
+void
+setUp(void)
+{}
+
+void
+tearDown(void)
+{}
+
+int
+main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(_should_setOrbitPrecCorrectly_when_providePrec);
+    RUN_TEST(_should_storeAllIterations_when_referenceIsInsideMandelbrotSet);
+    RUN_TEST(_should_stopAtEscape_when_referenceIsOutsideMandelbrotSet);
+    RUN_TEST(_should_matchMpfKernel_when_usePerturbedKernel);
+    RUN_TEST(_should_matchUnskippedKernel_when_skipIterationsBySeries);
+    RUN_TEST(_should_matchMpfKernel_when_useFloatExpKernel);
+    RUN_TEST(_should_flagGlitch_when_pixelIsAtNucleusNearReference);
+    RUN_TEST(_should_returnFalse_when_pixelOutlivesReferenceOrbit);
+
+    return UNITY_END();
+}
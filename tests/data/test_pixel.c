@@ -1,5 +1,8 @@
 #include "unity.h"
 
+#include <cutil/std/math.h>
+#include <cutil/util/macro.h>
+
 #include <data/pixel.h>
 #include <visuals/palette.h>
 
@@ -24,6 +27,119 @@ _pixelData_assert_prec(const PixelData *px, mp_bitcnt_t prec)
     TEST_ASSERT_EQUAL_UINT(prec, mpf_get_prec(px->im));
 }
 
+/**
+ * Positions inside and outside of the Mandelbrot set at which the kernels are
+ * compared with the mpf kernel
+ */
+static const double TEST_POSITIONS[][2] = {
+  {2.0, 2.0},   {0.5, 0.5},    {-0.75, 0.2}, {-1.5, 0.1},
+  {0.3, -0.6},  {-0.1, 0.9},   {0.26, 0.0},  {-2.1, 0.0},
+  {0.1, 0.1},   {-1.25, 0.05}, {0.4, 0.3},   {-0.5, -0.6},
+};
+
+#define TEST_NUM_POSITIONS ((sizeof TEST_POSITIONS) / (sizeof *TEST_POSITIONS))
+
+/**
+ * Kernel compared with the mpf kernel, which iterates `px` at the position in
+ * its mpf fields
+ */
+typedef void
+Kernel_callback(PixelData *px, PixelDataBuffer *buf, uint16_t max_itrs);
+
+static void
+_kernel_iterate_double(PixelData *px, PixelDataBuffer *buf, uint16_t max_itrs)
+{
+    CUTIL_UNUSED(buf);
+    PixelData_iterate_double(
+      px, mpf_get_d(px->re), mpf_get_d(px->im), 4.0,
+      PixelData_get_tolerance(0.0), max_itrs
+    );
+}
+
+static void
+_kernel_iterate_fixed(PixelData *px, PixelDataBuffer *buf, uint16_t max_itrs)
+{
+    TEST_ASSERT_TRUE(PixelData_iterate_fixed(px, buf, max_itrs));
+}
+
+static void
+_kernel_iterate_fixed_or_mpf(
+  PixelData *px, PixelDataBuffer *buf, uint16_t max_itrs
+)
+{
+    if (!PixelData_iterate_fixed(px, buf, max_itrs)) {
+        PixelData_iterate(px, buf, max_itrs);
+    }
+}
+
+static void
+_kernel_iterate_ddouble(PixelData *px, PixelDataBuffer *buf, uint16_t max_itrs)
+{
+    CUTIL_UNUSED(buf);
+    PixelData_iterate_ddouble(
+      px, DoubleDouble_from_mpf(px->re), DoubleDouble_from_mpf(px->im), 4.0,
+      PixelData_get_tolerance(0.0), max_itrs
+    );
+}
+
+static void
+_kernel_iterate_qdouble(PixelData *px, PixelDataBuffer *buf, uint16_t max_itrs)
+{
+    CUTIL_UNUSED(buf);
+    PixelData_iterate_qdouble(
+      px, QuadDouble_from_mpf(px->re), QuadDouble_from_mpf(px->im), 4.0,
+      PixelData_get_tolerance(0.0), max_itrs
+    );
+}
+
+/**
+ * Asserts that `kernel` matches the mpf kernel at the `num` `positions` at the
+ * default precision, with the imaginary parts offset by 2^-`offs_bits` unless
+ * `offs_bits` is zero.
+ */
+static void
+_pixelData_assert_match_mpf(
+  Kernel_callback *kernel, const double (*positions)[2], size_t num,
+  mp_bitcnt_t offs_bits, uint16_t max_itrs
+)
+{
+    PixelData px_mpf = {0};
+    PixelData px = {0};
+    PixelDataBuffer buf = {0};
+
+    mpf_t max_sqr, offs;
+    mpf_init_set_d(max_sqr, 4.0);
+    mpf_init_set_d(offs, 1.0);
+    mpf_div_2exp(offs, offs, offs_bits);
+
+    PixelData_init(&px_mpf);
+    PixelData_init(&px);
+    PixelDataBuffer_init(&buf, max_sqr);
+
+    for (size_t i = 0; i < num; ++i) {
+        mpf_set_d(px_mpf.re, positions[i][0]);
+        mpf_set_d(px_mpf.im, positions[i][1]);
+        if (offs_bits != 0) {
+            mpf_add(px_mpf.im, px_mpf.im, offs);
+        }
+        mpf_set(px.re, px_mpf.re);
+        mpf_set(px.im, px_mpf.im);
+
+        /* Act */
+        PixelData_iterate(&px_mpf, &buf, max_itrs);
+        kernel(&px, &buf, max_itrs);
+
+        /* Assert */
+        TEST_ASSERT_EQUAL_FLOAT(px_mpf.itrs, px.itrs);
+    }
+
+    PixelData_clear(&px_mpf);
+    PixelData_clear(&px);
+    PixelDataBuffer_clear(&buf);
+    mpf_clear(max_sqr);
+    mpf_clear(offs);
+}
+
 static void
 _should_initBufferCorrectly_when_provideMaxSqr(void)
 {
@@ -84,6 +200,42 @@ _should_setBufferPrecCorrectly_when_providePrec(void)
     mpf_clear(max_sqr);
 }
 
+static void
+_should_setBufferTolerance_when_provideUpp(void)
+{
+    /* Arrange */
+    const mp_bitcnt_t prec = 256UL;
+    PixelDataBuffer buf = {0};
+
+    mpf_t max_sqr;
+    mpf_init_set_d(max_sqr, 4.0);
+    mpf_t upp;
+    mpf_init2(upp, prec);
+
+    PixelDataBuffer_init(&buf, max_sqr);
+    PixelDataBuffer_set_prec(&buf, prec);
+    const long int min_tol_exp = 16L - (long int) mpf_get_prec(buf.re);
+
+    /* Act */
+    mpf_set_d(upp, ldexp(1.0, -20));
+    PixelDataBuffer_set_tolerance(&buf, upp);
+    const long int tol_exp_shallow = buf.tol_exp;
+    mpf_set_ui(upp, 1UL);
+    mpf_div_2exp(upp, upp, 300UL);
+    PixelDataBuffer_set_tolerance(&buf, upp);
+    const long int tol_exp_deep = buf.tol_exp;
+
+    /* Assert */
+    /* 2^-20 = 0.5 * 2^-19 is 10 binary digits above the tolerance */
+    TEST_ASSERT_EQUAL_INT(-19 - 10, tol_exp_shallow);
+    TEST_ASSERT_EQUAL_INT(min_tol_exp, tol_exp_deep);
+
+    /* Cleanup */
+    PixelDataBuffer_clear(&buf);
+    mpf_clear(upp);
+    mpf_clear(max_sqr);
+}
+
 static void
 _should_initPixelCorrectly_when_initializePixelData(void)
 {
@@ -98,6 +250,7 @@ _should_initPixelCorrectly_when_initializePixelData(void)
     _pixelData_assert_prec(&px, prec);
     TEST_ASSERT_EQUAL_INT(PIXEL_STATE_INVALID, px.state);
     TEST_ASSERT_EQUAL_FLOAT(PALETTE_INVALID_POS, px.itrs);
+    TEST_ASSERT_EQUAL_UINT(PIXEL_FLAG_NONE, px.flags);
 
     /* Cleanup */
     PixelData_clear(&px);
@@ -211,6 +364,431 @@ _should_bePeriodic_when_pixelIsAtPeriodicPoint(void)
     mpf_clear(max_sqr);
 }
 
+void
+_should_bePeriodic_when_pixelIsInPeriodThreeBulb(void)
+{
+    /* Arrange */
+    PixelData px = {0};
+    PixelDataBuffer buf = {0};
+
+    mpf_t max_sqr;
+    mpf_init_set_d(max_sqr, 4.0);
+    mpf_t upp;
+    mpf_init_set_d(upp, 1.0e-3);
+
+    PixelData_init(&px);
+    PixelDataBuffer_init(&buf, max_sqr);
+    PixelDataBuffer_set_tolerance(&buf, upp);
+
+    mpf_set_d(px.re, -0.1226);
+    mpf_set_d(px.im, 0.7449);
+
+    /* Act */
+    PixelData_iterate(&px, &buf, 10000);
+    const float itrs_mpf = px.itrs;
+    const bool done = PixelData_iterate_fixed(&px, &buf, 10000);
+    const float itrs_fix = px.itrs;
+
+    /* Assert */
+    TEST_ASSERT_EQUAL_FLOAT(0.0F, itrs_mpf);
+    TEST_ASSERT_TRUE(done);
+    TEST_ASSERT_EQUAL_FLOAT(0.0F, itrs_fix);
+
+    /* Cleanup */
+    PixelData_clear(&px);
+    PixelDataBuffer_clear(&buf);
+    mpf_clear(upp);
+    mpf_clear(max_sqr);
+}
+
+void
+_should_flagDerivative_when_pixelIsNearParabolicPoint(void)
+{
+    /* Arrange */
+    const double positions[][2] = {
+      {-0.1249, 0.652}, /* Inside period-3 bulb, close to its root */
+      {-0.75, 0.001},   /* Outside, close to root of period-2 bulb */
+    };
+    const unsigned int flags[] = {PIXEL_FLAG_DERIVATIVE, PIXEL_FLAG_NONE};
+    const size_t num = (sizeof flags) / (sizeof *flags);
+    const uint16_t max_itrs = 20000;
+
+    PixelData px = {0};
+    PixelDataBuffer buf = {0};
+
+    mpf_t max_sqr;
+    mpf_init_set_d(max_sqr, 4.0);
+    mpf_t upp;
+    mpf_init_set_d(upp, 1.0e-6);
+
+    PixelData_init(&px);
+    PixelDataBuffer_init(&buf, max_sqr);
+    PixelDataBuffer_set_tolerance(&buf, upp);
+
+    for (size_t i = 0; i < num; ++i) {
+        mpf_set_d(px.re, positions[i][0]);
+        mpf_set_d(px.im, positions[i][1]);
+
+        /* Act */
+        PixelData_iterate(&px, &buf, max_itrs);
+        const unsigned int flags_mpf = px.flags;
+        const float itrs_mpf = px.itrs;
+        const bool done = PixelData_iterate_fixed(&px, &buf, max_itrs);
+
+        /* Assert */
+        TEST_ASSERT_EQUAL_UINT(flags[i], flags_mpf);
+        TEST_ASSERT_TRUE(done);
+        TEST_ASSERT_EQUAL_UINT(flags[i], px.flags);
+        TEST_ASSERT_EQUAL_FLOAT(itrs_mpf, px.itrs);
+        TEST_ASSERT_EQUAL(flags[i] == PIXEL_FLAG_DERIVATIVE, px.itrs == 0.0F);
+    }
+
+    /* Cleanup */
+    PixelData_clear(&px);
+    PixelDataBuffer_clear(&buf);
+    mpf_clear(upp);
+    mpf_clear(max_sqr);
+}
+
+void
+_should_converge_when_pixelIsAtOriginWithDoubleKernel(void)
+{
+    /* Arrange */
+    PixelData px = {0};
+    PixelData_init(&px);
+
+    /* Act */
+    PixelData_iterate_double(
+      &px, 0.0, 0.0, 4.0, PixelData_get_tolerance(0.0), 100
+    );
+
+    /* Assert */
+    TEST_ASSERT_EQUAL_FLOAT(0.0F, px.itrs);
+
+    /* Cleanup */
+    PixelData_clear(&px);
+}
+
+void
+_should_bePeriodic_when_pixelIsAtPeriodicPointWithDoubleKernel(void)
+{
+    /* Arrange */
+    PixelData px = {0};
+    PixelData_init(&px);
+
+    /* Act */
+    PixelData_iterate_double(
+      &px, -1.0, 0.0, 4.0, PixelData_get_tolerance(0.0), 100
+    );
+
+    /* Assert */
+    TEST_ASSERT_EQUAL_FLOAT(0.0F, px.itrs);
+
+    /* Cleanup */
+    PixelData_clear(&px);
+}
+
+void
+_should_matchMpfKernel_when_useDoubleKernel(void)
+{
+    _pixelData_assert_match_mpf(
+      &_kernel_iterate_double, TEST_POSITIONS, TEST_NUM_POSITIONS, 0, 500
+    );
+}
+
+void
+_should_returnLimbCount_when_precisionIsSupported(void)
+{
+    /* Arrange */
+    /* Act */
+    /* Assert */
+    TEST_ASSERT_EQUAL_INT(1, PixelData_get_fixed_limbs(32UL));
+    TEST_ASSERT_EQUAL_INT(2, PixelData_get_fixed_limbs(64UL));
+    TEST_ASSERT_EQUAL_INT(16, PixelData_get_fixed_limbs(1016UL));
+    TEST_ASSERT_EQUAL_INT(0, PixelData_get_fixed_limbs(1024UL));
+}
+
+void
+_should_matchMpfKernel_when_useFixedKernel(void)
+{
+    const mp_bitcnt_t precs[] = {64UL, 256UL, 640UL, 960UL};
+    const size_t num_precs = (sizeof precs) / (sizeof *precs);
+
+    for (size_t j = 0; j < num_precs; ++j) {
+        mpf_set_default_prec(precs[j]);
+
+        /* Offset beyond double precision only resolved by both kernels */
+        _pixelData_assert_match_mpf(
+          &_kernel_iterate_fixed, TEST_POSITIONS, TEST_NUM_POSITIONS,
+          precs[j] / 2, 500
+        );
+    }
+}
+
+void
+_should_matchMpfKernel_when_useFixedKernelFarFromOrigin(void)
+{
+    /* Arrange */
+    const double positions[][2] = {
+      {16.0, 0.5}, {-16.0, 0.5}, {3.5, -3.5}, {-3.9, 0.0}, {100.0, 100.0},
+    };
+    const size_t num = (sizeof positions) / (sizeof *positions);
+
+    mpf_set_default_prec(64UL);
+
+    /* Positions out of range of fixed point are left to the mpf kernel */
+    _pixelData_assert_match_mpf(
+      &_kernel_iterate_fixed_or_mpf, positions, num, 0, 500
+    );
+}
+
+void
+_should_matchMpfKernel_when_useMultiDoubleKernels(void)
+{
+    mpf_set_default_prec(256UL);
+
+    /* Offset beyond double precision only resolved by all kernels */
+    _pixelData_assert_match_mpf(
+      &_kernel_iterate_ddouble, TEST_POSITIONS, TEST_NUM_POSITIONS, 90UL, 500
+    );
+    _pixelData_assert_match_mpf(
+      &_kernel_iterate_qdouble, TEST_POSITIONS, TEST_NUM_POSITIONS, 90UL, 500
+    );
+}
+
+void
+_should_matchScalarKernel_when_iterateSegment(void)
+{
+    /* Arrange */
+    enum { NUM_RE = 24, NUM_IM = 37 };
+    const double min_re = -2.0;
+    const double min_im = -1.25;
+    const double d_re = 3.0 / NUM_RE;
+    const double d_im = 2.5 / NUM_IM;
+    const uint16_t max_itrs = 500;
+    const double tol = PixelData_get_tolerance(d_im);
+
+    /* Escape counts may only differ due to rounding (see documentation) */
+    const int max_mismatches = (NUM_RE * NUM_IM) / 100;
+    const float tolerance = 1.0F / max_itrs;
+
+    PixelData px = {0};
+    PixelData segment[NUM_IM];
+
+    PixelData_init(&px);
+    for (int idx_im = 0; idx_im < NUM_IM; ++idx_im) {
+        PixelData_init(&segment[idx_im]);
+    }
+
+    /* Every variant the CPU supports has to match */
+    const enum CpuIsa max_isa = Cpu_detect_isa();
+    for (int isa = CPU_ISA_BASELINE; isa <= (int) max_isa; ++isa) {
+        PixelData_select_isa((enum CpuIsa) isa);
+        int mismatches = 0;
+        for (int idx_re = 0; idx_re < NUM_RE; ++idx_re) {
+            const double re = min_re + idx_re * d_re;
+
+            /* Act */
+            PixelData_iterate_double_segment(
+              segment, NUM_IM, re, min_im, d_im, 4.0, tol, max_itrs
+            );
+
+            /* Assert */
+            for (int idx_im = 0; idx_im < NUM_IM; ++idx_im) {
+                const double im = min_im + idx_im * d_im;
+                PixelData_iterate_double(&px, re, im, 4.0, tol, max_itrs);
+                TEST_ASSERT_EQUAL_INT(
+                  PIXEL_STATE_VALID, segment[idx_im].state
+                );
+                if (fabsf(segment[idx_im].itrs - px.itrs) > tolerance) {
+                    ++mismatches;
+                }
+            }
+        }
+        TEST_ASSERT_LESS_OR_EQUAL_INT(max_mismatches, mismatches);
+    }
+
+    /* Cleanup */
+    PixelData_clear(&px);
+    for (int idx_im = 0; idx_im < NUM_IM; ++idx_im) {
+        PixelData_clear(&segment[idx_im]);
+    }
+}
+
+static void
+_should_matchSegments_when_iterateColumns(void)
+{
+    /* Arrange */
+    enum { NUM_RE = 19, NUM_IM = 13 };
+    const double min_re = -2.0;
+    const double min_im = -1.25;
+    const double d_re = 3.0 / NUM_RE;
+    const double d_im = 2.5 / NUM_IM;
+    const uint16_t max_itrs = 500;
+    const double tol = PixelData_get_tolerance(d_im);
+
+    PixelData rows[NUM_RE * NUM_IM];
+    PixelData cols[NUM_RE * NUM_IM];
+    for (int idx = 0; idx < NUM_RE * NUM_IM; ++idx) {
+        PixelData_init(&rows[idx]);
+        PixelData_init(&cols[idx]);
+    }
+
+    /* Every variant the CPU supports has to match */
+    const enum CpuIsa max_isa = Cpu_detect_isa();
+    for (int isa = CPU_ISA_BASELINE; isa <= (int) max_isa; ++isa) {
+        PixelData_select_isa((enum CpuIsa) isa);
+        for (int idx_re = 0; idx_re < NUM_RE; ++idx_re) {
+            const double re = min_re + idx_re * d_re;
+            PixelData_iterate_double_segment(
+              &rows[idx_re * NUM_IM], NUM_IM, re, min_im, d_im, 4.0, tol,
+              max_itrs
+            );
+        }
+
+        /* Act */
+        for (int idx_im = 0; idx_im < NUM_IM; ++idx_im) {
+            const double im = min_im + idx_im * d_im;
+            PixelData_iterate_double_column(
+              &cols[idx_im], NUM_IM, NUM_RE, min_re, im, d_re, 4.0, tol,
+              max_itrs
+            );
+        }
+
+        /* Assert */
+        for (int idx = 0; idx < NUM_RE * NUM_IM; ++idx) {
+            TEST_ASSERT_EQUAL_INT(PIXEL_STATE_VALID, cols[idx].state);
+            TEST_ASSERT_EQUAL_FLOAT(rows[idx].itrs, cols[idx].itrs);
+        }
+    }
+
+    /* Cleanup */
+    for (int idx = 0; idx < NUM_RE * NUM_IM; ++idx) {
+        PixelData_clear(&rows[idx]);
+        PixelData_clear(&cols[idx]);
+    }
+}
+
+static void
+_should_matchSegments_when_iterateLinesSkippingPixels(void)
+{
+    /* Arrange */
+    enum { NUM_RE = 7, NUM_IM = 16, SPACING = 2 };
+    const double min_re = -2.0;
+    const double min_im = -1.25;
+    const double d_re = 3.0 / NUM_RE;
+    const double d_im = 2.5 / NUM_IM;
+    const uint16_t max_itrs = 500;
+    const double tol = PixelData_get_tolerance(d_im);
+
+    PixelData rows[NUM_RE * NUM_IM];
+    PixelData lines[NUM_RE * NUM_IM];
+    for (int idx = 0; idx < NUM_RE * NUM_IM; ++idx) {
+        PixelData_init(&rows[idx]);
+        PixelData_init(&lines[idx]);
+        lines[idx].state = PIXEL_STATE_INVALID;
+    }
+
+    for (int idx_re = 0; idx_re < NUM_RE; ++idx_re) {
+        const double re = min_re + idx_re * d_re;
+        PixelData_iterate_double_segment(
+          &rows[idx_re * NUM_IM], NUM_IM, re, min_im, d_im, 4.0, tol, max_itrs
+        );
+    }
+
+    /* Act */
+    for (int idx_re = 0; idx_re < NUM_RE; ++idx_re) {
+        const double re = min_re + idx_re * d_re;
+        PixelData_iterate_double_line(
+          &lines[idx_re * NUM_IM], SPACING, NUM_IM / SPACING, re, min_im, 0.0,
+          SPACING * d_im, 4.0, tol, max_itrs
+        );
+    }
+
+    /* Assert */
+    for (int idx = 0; idx < NUM_RE * NUM_IM; ++idx) {
+        if (idx % SPACING != 0) {
+            TEST_ASSERT_EQUAL_INT(PIXEL_STATE_INVALID, lines[idx].state);
+            continue;
+        }
+        TEST_ASSERT_EQUAL_INT(PIXEL_STATE_VALID, lines[idx].state);
+        TEST_ASSERT_EQUAL_FLOAT(rows[idx].itrs, lines[idx].itrs);
+    }
+
+    /* Cleanup */
+    for (int idx = 0; idx < NUM_RE * NUM_IM; ++idx) {
+        PixelData_clear(&rows[idx]);
+        PixelData_clear(&lines[idx]);
+    }
+}
+
+static void
+_should_matchDoubleKernel_when_intervalIsProvenUniform(void)
+{
+    /* Arrange */
+    const double tiles[][4] = {
+      {1.5, 1.51, 1.5, 1.51},
+      {-0.11, -0.09, -0.01, 0.01},
+      {0.79, 0.8, 0.0, 0.01},
+      {-0.3, -0.29, -0.3, -0.29},
+    };
+    const size_t num = (sizeof tiles) / (sizeof *tiles);
+    const int num_samples = 5;
+    const uint16_t max_itrs = 1000;
+    const double tol = PixelData_get_tolerance(1e-6);
+
+    PixelData px = {0};
+    PixelData sample = {0};
+    PixelData_init(&px);
+    PixelData_init(&sample);
+
+    for (size_t i = 0; i < num; ++i) {
+        const Interval re = Interval_from_bounds(tiles[i][0], tiles[i][1]);
+        const Interval im = Interval_from_bounds(tiles[i][2], tiles[i][3]);
+
+        /* Act */
+        const bool is_uniform
+          = PixelData_iterate_interval(&px, re, im, 4.0, max_itrs);
+
+        /* Assert */
+        TEST_ASSERT_TRUE(is_uniform);
+        for (int j = 0; j < num_samples; ++j) {
+            for (int k = 0; k < num_samples; ++k) {
+                const double frac_re = 1.0 * j / (num_samples - 1);
+                const double frac_im = 1.0 * k / (num_samples - 1);
+                PixelData_iterate_double(
+                  &sample, re.lo + frac_re * (re.hi - re.lo),
+                  im.lo + frac_im * (im.hi - im.lo), 4.0, tol, max_itrs
+                );
+                TEST_ASSERT_EQUAL_FLOAT(px.itrs, sample.itrs);
+            }
+        }
+    }
+
+    /* Cleanup */
+    PixelData_clear(&px);
+    PixelData_clear(&sample);
+}
+
+static void
+_should_notBeUniform_when_intervalContainsBoundary(void)
+{
+    /* Arrange */
+    const Interval re = Interval_from_bounds(0.2, 0.3);
+    const Interval im = Interval_from_bounds(-0.01, 0.01);
+    PixelData px = {0};
+    PixelData_init(&px);
+
+    /* Act */
+    const bool is_uniform = PixelData_iterate_interval(&px, re, im, 4.0, 1000);
+
+    /* Assert */
+    TEST_ASSERT_FALSE(is_uniform);
+
+    /* Cleanup */
+    PixelData_clear(&px);
+}
+
 void
 setUp(void)
 {}
@@ -226,11 +804,26 @@ main(void)
 
     RUN_TEST(_should_initBufferCorrectly_when_provideMaxSqr);
     RUN_TEST(_should_setBufferPrecCorrectly_when_providePrec);
+    RUN_TEST(_should_setBufferTolerance_when_provideUpp);
     RUN_TEST(_should_initPixelCorrectly_when_initializePixelData);
     RUN_TEST(_should_setPixelPrecCorrectly_when_providePrec);
     RUN_TEST(_should_converge_when_pixelIsAtOrigin);
     RUN_TEST(_should_diverge_when_pixelIsOutsideMandelbrotSet);
     RUN_TEST(_should_bePeriodic_when_pixelIsAtPeriodicPoint);
+    RUN_TEST(_should_bePeriodic_when_pixelIsInPeriodThreeBulb);
+    RUN_TEST(_should_flagDerivative_when_pixelIsNearParabolicPoint);
+    RUN_TEST(_should_converge_when_pixelIsAtOriginWithDoubleKernel);
+    RUN_TEST(_should_bePeriodic_when_pixelIsAtPeriodicPointWithDoubleKernel);
+    RUN_TEST(_should_matchMpfKernel_when_useDoubleKernel);
+    RUN_TEST(_should_matchScalarKernel_when_iterateSegment);
+    RUN_TEST(_should_matchSegments_when_iterateColumns);
+    RUN_TEST(_should_matchSegments_when_iterateLinesSkippingPixels);
+    RUN_TEST(_should_matchDoubleKernel_when_intervalIsProvenUniform);
+    RUN_TEST(_should_notBeUniform_when_intervalContainsBoundary);
+    RUN_TEST(_should_returnLimbCount_when_precisionIsSupported);
+    RUN_TEST(_should_matchMpfKernel_when_useFixedKernel);
+    RUN_TEST(_should_matchMpfKernel_when_useFixedKernelFarFromOrigin);
+    RUN_TEST(_should_matchMpfKernel_when_useMultiDoubleKernels);
     
     return UNITY_END();
 }
@@ -0,0 +1,144 @@
+#include "unity.h"
+
+#include <cutil/std/math.h>
+
+#include <util/floatexp.h>
+
+static void
+_should_normalizeMantissa_when_convertFromDouble(void)
+{
+    /* Arrange */
+    const double values[] = {1.0, -3.5, 0.1, 1e-300, -7e200, 0.75};
+    const size_t num = (sizeof values) / (sizeof *values);
+
+    for (size_t i = 0; i < num; ++i) {
+        /* Act */
+        const FloatExp x = FloatExp_from_double(values[i]);
+
+        /* Assert */
+        TEST_ASSERT_TRUE(fabs(x.mant) >= 0.5 && fabs(x.mant) < 1.0);
+        TEST_ASSERT_EQUAL_DOUBLE(values[i], FloatExp_to_double(x));
+    }
+}
+
+static void
+_should_haveZeroExponent_when_convertZero(void)
+{
+    /* Arrange */
+    /* Act */
+    const FloatExp x = FloatExp_from_double(0.0);
+
+    /* Assert */
+    TEST_ASSERT_EQUAL_DOUBLE(0.0, x.mant);
+    TEST_ASSERT_EQUAL_INT(0, x.exp);
+}
+
+static void
+_should_matchDouble_when_performArithmetic(void)
+{
+    /* Arrange */
+    const double values[][2] = {
+      {1.0, 2.0},    {-3.5, 0.25},  {1e-10, 3e-12},
+      {5.0, -5.0},   {0.0, 4.0},    {-1e20, 1e-20},
+    };
+    const size_t num = (sizeof values) / (sizeof *values);
+
+    for (size_t i = 0; i < num; ++i) {
+        const double a = values[i][0];
+        const double b = values[i][1];
+        const FloatExp fa = FloatExp_from_double(a);
+        const FloatExp fb = FloatExp_from_double(b);
+
+        /* Act */
+        const double sum = FloatExp_to_double(FloatExp_add(fa, fb));
+        const double diff = FloatExp_to_double(FloatExp_sub(fa, fb));
+        const double prod = FloatExp_to_double(FloatExp_mul(fa, fb));
+        const double prod_d = FloatExp_to_double(FloatExp_mul_d(fa, b));
+
+        /* Assert */
+        TEST_ASSERT_EQUAL_DOUBLE(a + b, sum);
+        TEST_ASSERT_EQUAL_DOUBLE(a - b, diff);
+        TEST_ASSERT_EQUAL_DOUBLE(a * b, prod);
+        TEST_ASSERT_EQUAL_DOUBLE(a * b, prod_d);
+    }
+}
+
+static void
+_should_keepExponent_when_resultIsBelowDoubleRange(void)
+{
+    /* Arrange */
+    const double a = 3e-300;
+    const double b = -2e-300;
+    const FloatExp fa = FloatExp_from_double(a);
+    const FloatExp fb = FloatExp_from_double(b);
+
+    /* Act */
+    const FloatExp prod = FloatExp_mul(fa, fb);
+
+    /* Assert */
+    TEST_ASSERT_EQUAL_DOUBLE(0.0, FloatExp_to_double(prod));
+
+    /* Rescaled into the range of double, it yields the rescaled product */
+    const double expected = ldexp(a, 997) * ldexp(b, 997);
+    const FloatExp scaled = FloatExp_normalize(prod.mant, prod.exp + 1994L);
+    const double result = FloatExp_to_double(scaled);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-15 * fabs(expected), expected, result);
+}
+
+static void
+_should_ignoreSmallSummand_when_exponentsDifferTooMuch(void)
+{
+    /* Arrange */
+    const FloatExp a = FloatExp_from_double(1.0);
+    const FloatExp b = FloatExp_normalize(0.5, -2000L);
+
+    /* Act */
+    const FloatExp sum = FloatExp_add(b, a);
+
+    /* Assert */
+    TEST_ASSERT_EQUAL_DOUBLE(a.mant, sum.mant);
+    TEST_ASSERT_EQUAL_INT(a.exp, sum.exp);
+}
+
+static void
+_should_convertCorrectly_when_provideMpf(void)
+{
+    /* Arrange */
+    mpf_t x;
+    mpf_init2(x, 128UL);
+    mpf_set_d(x, 0.75);
+    mpf_div_2exp(x, x, 5000UL);
+
+    /* Act */
+    const FloatExp fx = FloatExp_from_mpf(x);
+
+    /* Assert */
+    TEST_ASSERT_EQUAL_DOUBLE(0.75, fx.mant);
+    TEST_ASSERT_EQUAL_INT(-5000, fx.exp);
+
+    /* Cleanup */
+    mpf_clear(x);
+}
+
+void
+setUp(void)
+{}
+
+void
+tearDown(void)
+{}
+
+int
+main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(_should_normalizeMantissa_when_convertFromDouble);
+    RUN_TEST(_should_haveZeroExponent_when_convertZero);
+    RUN_TEST(_should_matchDouble_when_performArithmetic);
+    RUN_TEST(_should_keepExponent_when_resultIsBelowDoubleRange);
+    RUN_TEST(_should_ignoreSmallSummand_when_exponentsDifferTooMuch);
+    RUN_TEST(_should_convertCorrectly_when_provideMpf);
+
+    return UNITY_END();
+}
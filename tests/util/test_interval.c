@@ -0,0 +1,89 @@
+#include "unity.h"
+
+#include <cutil/std/math.h>
+
+#include <util/interval.h>
+
+static void
+_should_encloseExactResult_when_performArithmetic(void)
+{
+    /* Arrange */
+    const Interval a = Interval_from_bounds(0.1, 0.3);
+    const Interval b = Interval_from_bounds(-0.7, 0.2);
+    const double points_a[] = {0.1, 0.2, 0.3};
+    const double points_b[] = {-0.7, 0.0, 0.2};
+    const size_t num = (sizeof points_a) / (sizeof *points_a);
+
+    /* Act */
+    const Interval sum = Interval_add(a, b);
+    const Interval diff = Interval_sub(a, b);
+    const Interval prod = Interval_mul(a, b);
+
+    /* Assert */
+    for (size_t i = 0; i < num; ++i) {
+        for (size_t j = 0; j < num; ++j) {
+            const double x = points_a[i];
+            const double y = points_b[j];
+            TEST_ASSERT_TRUE(sum.lo < x + y && x + y < sum.hi);
+            TEST_ASSERT_TRUE(diff.lo < x - y && x - y < diff.hi);
+            TEST_ASSERT_TRUE(prod.lo < x * y && x * y < prod.hi);
+        }
+    }
+    TEST_ASSERT_DOUBLE_WITHIN(1e-15, -0.6, sum.lo);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-15, 1.0, diff.hi);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-15, -0.21, prod.lo);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-15, 0.06, prod.hi);
+}
+
+static void
+_should_notBeNegative_when_squareIntervalContainingZero(void)
+{
+    /* Arrange */
+    const Interval a = Interval_from_bounds(-0.5, 0.25);
+
+    /* Act */
+    const Interval sqr = Interval_sqr(a);
+    const Interval prod = Interval_mul(a, a);
+
+    /* Assert */
+    TEST_ASSERT_TRUE(sqr.lo <= 0.0 && sqr.lo > -1e-300);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-15, 0.25, sqr.hi);
+    TEST_ASSERT_TRUE(prod.lo < -0.1);
+    TEST_ASSERT_TRUE(Interval_is_subset(sqr, prod));
+}
+
+static void
+_should_checkContainment_when_compareIntervals(void)
+{
+    /* Arrange */
+    const Interval outer = Interval_from_bounds(-1.0, 1.0);
+    const Interval inner = Interval_from_bounds(-0.5, 1.0);
+    const Interval overlapping = Interval_from_bounds(0.5, 1.5);
+
+    /* Act */
+    /* Assert */
+    TEST_ASSERT_TRUE(Interval_is_subset(inner, outer));
+    TEST_ASSERT_TRUE(Interval_is_subset(outer, outer));
+    TEST_ASSERT_FALSE(Interval_is_subset(outer, inner));
+    TEST_ASSERT_FALSE(Interval_is_subset(overlapping, outer));
+}
+
+void
+setUp(void)
+{}
+
+void
+tearDown(void)
+{}
+
+int
+main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(_should_encloseExactResult_when_performArithmetic);
+    RUN_TEST(_should_notBeNegative_when_squareIntervalContainingZero);
+    RUN_TEST(_should_checkContainment_when_compareIntervals);
+
+    return UNITY_END();
+}
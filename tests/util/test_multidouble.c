@@ -0,0 +1,187 @@
+#include "unity.h"
+
+#include <cutil/std/math.h>
+
+#include <util/multidouble.h>
+
+/* Precision of reference computations */
+#define REFERENCE_PRECISION 512UL
+
+/**
+ * Returns |`x` - `ref`| / |`ref`| as double using `tmp` as buffer.
+ */
+static double
+_get_relative_error(mpf_srcptr x, mpf_srcptr ref, mpf_ptr tmp)
+{
+    mpf_sub(tmp, x, ref);
+    mpf_div(tmp, tmp, ref);
+    return fabs(mpf_get_d(tmp));
+}
+
+static void
+_mpf_set_dd(mpf_ptr res, DoubleDouble x, mpf_ptr tmp)
+{
+    mpf_set_d(res, x.hi);
+    mpf_set_d(tmp, x.lo);
+    mpf_add(res, res, tmp);
+}
+
+static void
+_mpf_set_qd(mpf_ptr res, QuadDouble x, mpf_ptr tmp)
+{
+    mpf_set_d(res, x.x[0]);
+    for (int i = 1; i < 4; ++i) {
+        mpf_set_d(tmp, x.x[i]);
+        mpf_add(res, res, tmp);
+    }
+}
+
+static void
+_should_beExact_when_applyErrorFreeTransformations(void)
+{
+    /* Arrange */
+    const double a = 1.0 + ldexp(1.0, -40);
+    const double b = 3.0 * ldexp(1.0, -60);
+
+    /* Act */
+    double sum_err = 0.0;
+    double prod_err = 0.0;
+    const double sum = MultiDouble_two_sum(a, b, &sum_err);
+    const double prod = MultiDouble_two_prod(a, a, &prod_err);
+
+    /* Assert */
+    TEST_ASSERT_EQUAL_DOUBLE(a, sum);
+    TEST_ASSERT_EQUAL_DOUBLE(b, sum_err);
+    TEST_ASSERT_EQUAL_DOUBLE(1.0 + ldexp(1.0, -39), prod);
+    TEST_ASSERT_EQUAL_DOUBLE(ldexp(1.0, -80), prod_err);
+}
+
+static void
+_should_matchMpf_when_performDoubleDoubleArithmetic(void)
+{
+    /* Arrange */
+    mpf_set_default_prec(REFERENCE_PRECISION);
+    mpf_t a, b, ref, res, tmp;
+    mpf_init(a);
+    mpf_init(b);
+    mpf_init(ref);
+    mpf_init(res);
+    mpf_init(tmp);
+
+    /* a = 1/3, b = -sqrt(2)/7 */
+    mpf_set_ui(a, 1UL);
+    mpf_div_ui(a, a, 3UL);
+    mpf_sqrt_ui(b, 2UL);
+    mpf_div_ui(b, b, 7UL);
+    mpf_neg(b, b);
+
+    const DoubleDouble da = DoubleDouble_from_mpf(a);
+    const DoubleDouble db = DoubleDouble_from_mpf(b);
+    const double tol = ldexp(1.0, -100);
+
+    /* Act */
+    const DoubleDouble sum = DoubleDouble_add(da, db);
+    const DoubleDouble prod = DoubleDouble_mul(da, db);
+    const DoubleDouble sqr = DoubleDouble_sqr(db);
+
+    /* Assert */
+    _mpf_set_dd(res, da, tmp);
+    TEST_ASSERT_TRUE(_get_relative_error(res, a, tmp) < tol);
+
+    mpf_add(ref, a, b);
+    _mpf_set_dd(res, sum, tmp);
+    TEST_ASSERT_TRUE(_get_relative_error(res, ref, tmp) < tol);
+
+    mpf_mul(ref, a, b);
+    _mpf_set_dd(res, prod, tmp);
+    TEST_ASSERT_TRUE(_get_relative_error(res, ref, tmp) < tol);
+
+    mpf_mul(ref, b, b);
+    _mpf_set_dd(res, sqr, tmp);
+    TEST_ASSERT_TRUE(_get_relative_error(res, ref, tmp) < tol);
+
+    /* Cleanup */
+    mpf_clear(a);
+    mpf_clear(b);
+    mpf_clear(ref);
+    mpf_clear(res);
+    mpf_clear(tmp);
+}
+
+static void
+_should_matchMpf_when_performQuadDoubleArithmetic(void)
+{
+    /* Arrange */
+    mpf_set_default_prec(REFERENCE_PRECISION);
+    mpf_t a, b, ref, res, tmp;
+    mpf_init(a);
+    mpf_init(b);
+    mpf_init(ref);
+    mpf_init(res);
+    mpf_init(tmp);
+
+    /* a = 1/3, b = -sqrt(2)/7 */
+    mpf_set_ui(a, 1UL);
+    mpf_div_ui(a, a, 3UL);
+    mpf_sqrt_ui(b, 2UL);
+    mpf_div_ui(b, b, 7UL);
+    mpf_neg(b, b);
+
+    const QuadDouble qa = QuadDouble_from_mpf(a);
+    const QuadDouble qb = QuadDouble_from_mpf(b);
+    const double tol = ldexp(1.0, -200);
+
+    /* Act */
+    const QuadDouble sum = QuadDouble_add(qa, qb);
+    const QuadDouble diff = QuadDouble_sub(qa, qb);
+    const QuadDouble prod = QuadDouble_mul(qa, qb);
+    const QuadDouble prod_d = QuadDouble_mul_d(qa, -37.0);
+
+    /* Assert */
+    _mpf_set_qd(res, qa, tmp);
+    TEST_ASSERT_TRUE(_get_relative_error(res, a, tmp) < tol);
+
+    mpf_add(ref, a, b);
+    _mpf_set_qd(res, sum, tmp);
+    TEST_ASSERT_TRUE(_get_relative_error(res, ref, tmp) < tol);
+
+    mpf_sub(ref, a, b);
+    _mpf_set_qd(res, diff, tmp);
+    TEST_ASSERT_TRUE(_get_relative_error(res, ref, tmp) < tol);
+
+    mpf_mul(ref, a, b);
+    _mpf_set_qd(res, prod, tmp);
+    TEST_ASSERT_TRUE(_get_relative_error(res, ref, tmp) < tol);
+
+    mpf_set_d(tmp, -37.0);
+    mpf_mul(ref, a, tmp);
+    _mpf_set_qd(res, prod_d, tmp);
+    TEST_ASSERT_TRUE(_get_relative_error(res, ref, tmp) < tol);
+
+    /* Cleanup */
+    mpf_clear(a);
+    mpf_clear(b);
+    mpf_clear(ref);
+    mpf_clear(res);
+    mpf_clear(tmp);
+}
+
+void
+setUp(void)
+{}
+
+void
+tearDown(void)
+{}
+
+int
+main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(_should_beExact_when_applyErrorFreeTransformations);
+    RUN_TEST(_should_matchMpf_when_performDoubleDoubleArithmetic);
+    RUN_TEST(_should_matchMpf_when_performQuadDoubleArithmetic);
+
+    return UNITY_END();
+}
@@ -141,6 +141,38 @@ _should_advanceTripMode_when_callTripModeGeneratorAdvance(void)
     TripModeGenerator_free(tripgen);
 }
 
+static void
+_should_matchPaletteFunctions_when_callPaletteMap(void)
+{
+    /* Arrange */
+    enum { NUM = 64, STRIDE = 3 };
+    float pos[NUM];
+    for (int idx = 0; idx < NUM; ++idx) {
+        pos[idx] = 1.0f * idx / (NUM - 1);
+    }
+    pos[0] = PALETTE_INVALID_POS;
+    uint32_t res[NUM * STRIDE] = {0};
+
+    /* Every variant the CPU supports has to match */
+    const enum CpuIsa max_isa = Cpu_detect_isa();
+    for (int isa = CPU_ISA_BASELINE; isa <= (int) max_isa; ++isa) {
+        Palette_select_isa((enum CpuIsa) isa);
+        for (size_t fnc = 0; fnc < PALETTE_FUNCTION_COUNT; ++fnc) {
+            Palette_fnc *const palette = PALETTE_FUNCTIONS[fnc];
+
+            /* Act */
+            Palette_map(palette, NULL, pos, NUM, res, STRIDE);
+
+            /* Assert */
+            for (int idx = 0; idx < NUM; ++idx) {
+                TEST_ASSERT_EQUAL_HEX32(
+                  palette(pos[idx], NULL), res[idx * STRIDE]
+                );
+            }
+        }
+    }
+}
+
 void
 setUp(void)
 {}
@@ -162,6 +194,7 @@ main(void)
     RUN_TEST(_should_returnValidColor_when_callPaletteUltraFractal);
     RUN_TEST(_should_cyclePalettes_when_callPaletteCyclerCycle);
     RUN_TEST(_should_advanceTripMode_when_callTripModeGeneratorAdvance);
+    RUN_TEST(_should_matchPaletteFunctions_when_callPaletteMap);
 
     return UNITY_END();
 }